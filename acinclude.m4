@@ -21,6 +21,12 @@ AC_DEFUN([AX_LIBREGF_CHECK_LOCAL],
       [Missing function: towupper],
       [1])
     ])
+
+  dnl Headers and functions used in libregf/libregf_memory_map.c
+  dnl memory mapped access is not supported when these are missing
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([mmap munmap])
   ])
 
 dnl Function to check if DLL support is needed
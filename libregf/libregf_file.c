@@ -35,6 +35,8 @@
 #include "libregf_io_handle.h"
 #include "libregf_key.h"
 #include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_key_path_cache.h"
 #include "libregf_key_tree.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
@@ -42,6 +44,11 @@
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
 #include "libregf_libuna.h"
+#include "libregf_memory_map.h"
+#include "libregf_walk_scheduler.h"
+
+#include "regf_cell_values.h"
+#include "regf_file_header.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -155,6 +162,7 @@ on_error:
 }
 
 /* Frees a file
+ * The keys retrieved from the file should be freed first, after the file is closed a key can only be freed
  * Returns 1 if successful or -1 on error
  */
 int libregf_file_free(
@@ -268,6 +276,7 @@ int libregf_file_open(
 {
 	libbfio_handle_t *file_io_handle       = NULL;
 	libregf_internal_file_t *internal_file = NULL;
+	libregf_memory_map_t *memory_map       = NULL;
 	static char *function                  = "libregf_file_open";
 	size_t filename_length                 = 0;
 
@@ -318,6 +327,73 @@ int libregf_file_open(
 	}
 	internal_file = (libregf_internal_file_t *) file;
 
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( internal_file->memory_map != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - memory map value already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( libregf_memory_map_initialize(
+		     &memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_memory_map_open(
+		     memory_map,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		/* The memory map is set before reading so that the hive bins reference the mapped data
+		 */
+		internal_file->memory_map = memory_map;
+
+		if( libregf_internal_file_open_data(
+		     internal_file,
+		     memory_map->data,
+		     memory_map->data_size,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %s.",
+			 function,
+			 filename );
+
+			internal_file->memory_map = NULL;
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -424,6 +500,12 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( memory_map != NULL )
+	{
+		libregf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -440,6 +522,7 @@ int libregf_file_open_wide(
 {
 	libbfio_handle_t *file_io_handle       = NULL;
 	libregf_internal_file_t *internal_file = NULL;
+	libregf_memory_map_t *memory_map       = NULL;
 	static char *function                  = "libregf_file_open_wide";
 	size_t filename_length                 = 0;
 
@@ -490,6 +573,73 @@ int libregf_file_open_wide(
 	}
 	internal_file = (libregf_internal_file_t *) file;
 
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( internal_file->memory_map != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - memory map value already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( libregf_memory_map_initialize(
+		     &memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_memory_map_open_wide(
+		     memory_map,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %ls.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		/* The memory map is set before reading so that the hive bins reference the mapped data
+		 */
+		internal_file->memory_map = memory_map;
+
+		if( libregf_internal_file_open_data(
+		     internal_file,
+		     memory_map->data,
+		     memory_map->data_size,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %ls.",
+			 function,
+			 filename );
+
+			internal_file->memory_map = NULL;
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -596,6 +746,12 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( memory_map != NULL )
+	{
+		libregf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -674,6 +830,17 @@ int libregf_file_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access not supported for a file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( access_flags & LIBREGF_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
@@ -773,7 +940,109 @@ on_error:
 	return( -1 );
 }
 
+/* Opens a file from a buffer
+ * The buffer is referenced and not copied, it must remain available and unchanged until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_open_memory(
+     libregf_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_open_memory";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access not supported for a buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_internal_file_open_data(
+	     internal_file,
+	     buffer,
+	     buffer_size,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Closes a file
+ * The keys retrieved from the file should be freed first, after the file is closed a key can only be freed
  * Returns 0 if successful or -1 on error
  */
 int libregf_file_close(
@@ -923,6 +1192,38 @@ int libregf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->key_path_cache != NULL )
+	{
+		if( libregf_key_path_cache_free(
+		     &( internal_file->key_path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key path cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_free(
+		     &( internal_file->key_item_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key item cache.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_file->hive_bins_list != NULL )
 	{
 		if( libregf_hive_bins_list_free(
@@ -939,6 +1240,25 @@ int libregf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->memory_map != NULL )
+	{
+		if( libregf_memory_map_free(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->file_data      = NULL;
+	internal_file->file_data_size = 0;
+
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -957,16 +1277,19 @@ int libregf_file_close(
 	return( result );
 }
 
-/* Opens a file for reading
+/* Opens a file from data in memory
+ * The data is referenced and not copied, it must remain available until the file is closed
  * Returns 1 if successful or -1 on error
  */
-int libregf_internal_file_open_read(
+int libregf_internal_file_open_data(
      libregf_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_internal_file_open_read";
-	size64_t file_size    = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_internal_file_open_data";
 
 	if( internal_file == NULL )
 	{
@@ -979,51 +1302,203 @@ int libregf_internal_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_header != NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file header value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		return( -1 );
 	}
-#endif
-	if( libregf_file_header_initialize(
-	     &( internal_file->file_header ),
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file data is set before reading so that the hive bins reference the data
+	 */
+	internal_file->file_data      = data;
+	internal_file->file_data_size = data_size;
+
+	if( libregf_file_open_file_io_handle(
+	     (libregf_file_t *) internal_file,
+	     file_io_handle,
+	     access_flags & ~( LIBREGF_ACCESS_FLAG_MEMORY_MAPPED ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	internal_file->file_data      = NULL;
+	internal_file->file_data_size = 0;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_internal_file_open_read(
+     libregf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_internal_file_open_read";
+	size64_t file_size    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libregf_file_header_initialize(
+	     &( internal_file->file_header ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1049,6 +1524,36 @@ int libregf_internal_file_open_read(
 
 		goto on_error;
 	}
+	if( libregf_io_handle_increment_counter(
+	     internal_file->io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ,
+	     (uint64_t) sizeof( regf_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_io_handle_increment_counter(
+	     internal_file->io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_READ_CALLS,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment number of read calls.",
+		 function );
+
+		goto on_error;
+	}
 	internal_file->io_handle->major_version = internal_file->file_header->major_format_version;
 	internal_file->io_handle->minor_version = internal_file->file_header->minor_format_version;
 
@@ -1123,8 +1628,9 @@ int libregf_internal_file_read_hive_bins(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_internal_file_read_hive_bins";
-	int result            = 0;
+	static char *function       = "libregf_internal_file_read_hive_bins";
+	int number_of_cache_entries = 0;
+	int result                  = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1186,6 +1692,24 @@ int libregf_internal_file_read_hive_bins(
 
 		goto on_error;
 	}
+	if( internal_file->file_data != NULL )
+	{
+		if( libregf_hive_bins_list_set_file_data(
+		     internal_file->hive_bins_list,
+		     internal_file->file_data,
+		     internal_file->file_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file data in hive bins list.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	result = libregf_hive_bins_list_read_file_io_handle(
 		  internal_file->hive_bins_list,
 		  file_io_handle,
@@ -1204,9 +1728,60 @@ int libregf_internal_file_read_hive_bins(
 
 		goto on_error;
 	}
+	/* The hive bins cannot contain more named keys than fit in their size
+	 */
+	number_of_cache_entries = internal_file->io_handle->maximum_number_of_cached_keys;
+
+	if( ( internal_file->file_header->hive_bins_size / sizeof( regf_named_key_t ) ) < (size_t) number_of_cache_entries )
+	{
+		number_of_cache_entries = (int) ( internal_file->file_header->hive_bins_size / sizeof( regf_named_key_t ) );
+	}
+	if( number_of_cache_entries <= 0 )
+	{
+		number_of_cache_entries = 1;
+	}
+	if( libregf_key_item_cache_initialize(
+	     &( internal_file->key_item_cache ),
+	     internal_file->io_handle,
+	     number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_cache_entries > LIBREGF_MAXIMUM_CACHE_ENTRIES_KEY_PATHS )
+	{
+		number_of_cache_entries = LIBREGF_MAXIMUM_CACHE_ENTRIES_KEY_PATHS;
+	}
+	if( libregf_key_path_cache_initialize(
+	     &( internal_file->key_path_cache ),
+	     number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key path cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( internal_file->key_item_cache != NULL )
+	{
+		libregf_key_item_cache_free(
+		 &( internal_file->key_item_cache ),
+		 NULL );
+	}
 	if( internal_file->hive_bins_list != NULL )
 	{
 		libregf_hive_bins_list_free(
@@ -1347,12 +1922,1399 @@ int libregf_file_is_corrupted(
 		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		return( -1 );
-	}
-#endif
-	if( ( internal_file->io_handle->flags & LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
-	{
-		result = 1;
+		return( -1 );
+	}
+#endif
+	result = libregf_io_handle_is_corrupted(
+	          internal_file->io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if IO handle is corrupted.",
+		 function );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_ascii_codepage(
+     libregf_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_set_ascii_codepage(
+     libregf_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBREGF_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum number of cached hive bins
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_maximum_number_of_cached_hive_bins(
+     libregf_file_t *file,
+     int *maximum_number_of_cached_hive_bins,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_maximum_number_of_cached_hive_bins";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_hive_bins == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cached hive bins.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_cached_hive_bins = internal_file->io_handle->maximum_number_of_cached_hive_bins;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of cached hive bins
+ * The hive bins cache of an open file is resized
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_set_maximum_number_of_cached_hive_bins(
+     libregf_file_t *file,
+     int maximum_number_of_cached_hive_bins,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file          = NULL;
+	static char *function                           = "libregf_file_set_maximum_number_of_cached_hive_bins";
+	int previous_maximum_number_of_cached_hive_bins = 0;
+	int result                                      = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_hive_bins <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of cached hive bins value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	previous_maximum_number_of_cached_hive_bins = internal_file->io_handle->maximum_number_of_cached_hive_bins;
+
+	internal_file->io_handle->maximum_number_of_cached_hive_bins = maximum_number_of_cached_hive_bins;
+
+	if( internal_file->hive_bins_list != NULL )
+	{
+		if( libregf_hive_bins_list_resize_cache(
+		     internal_file->hive_bins_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hive bins cache.",
+			 function );
+
+			internal_file->io_handle->maximum_number_of_cached_hive_bins = previous_maximum_number_of_cached_hive_bins;
+
+			result = -1;
+		}
+	}
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum number of cached values per key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_maximum_number_of_cached_values(
+     libregf_file_t *file,
+     int *maximum_number_of_cached_values,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_maximum_number_of_cached_values";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cached values per key.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_cached_values = internal_file->io_handle->maximum_number_of_cached_values;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of cached values per key
+ * This applies to keys of which the values are read after the maximum is set
+ * Key items that are cached by the file keep the values cache of the maximum
+ * that applied when their values were read, these caches are not resized
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_set_maximum_number_of_cached_values(
+     libregf_file_t *file,
+     int maximum_number_of_cached_values,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_set_maximum_number_of_cached_values";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of cached values per key value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->maximum_number_of_cached_values = maximum_number_of_cached_values;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific statistic
+ * The statistics are kept per open file and are reset when the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_statistic(
+     libregf_file_t *file,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_statistic";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libregf_io_handle_get_statistic(
+	     internal_file->io_handle,
+	     statistic_type,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistic: %d.",
+		 function,
+		 statistic_type );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_reset_statistics(
+     libregf_file_t *file,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_reset_statistics";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libregf_io_handle_reset_statistics(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Freezes the file
+ * Reads all hive bins into memory so that hive bin cells are retrieved without locking
+ * If the compiler does not provide atomic operations determining if the file is frozen requires a read lock
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_freeze(
+     libregf_file_t *file,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_freeze";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_file->hive_bins_list != NULL )
+	{
+		if( libregf_hive_bins_list_freeze(
+		     internal_file->hive_bins_list,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to freeze hive bins list.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_format_version(
+     libregf_file_t *file,
+     uint32_t *major_version,
+     uint32_t *minor_version,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor format version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*major_version = internal_file->file_header->major_format_version;
+	*minor_version = internal_file->file_header->minor_format_version;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the type
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_type(
+     libregf_file_t *file,
+     uint32_t *file_type,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_type";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_type = internal_file->file_header->file_type;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the root key
+ * Creates a new key
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libregf_file_get_root_key(
+     libregf_file_t *file,
+     libregf_key_t **key,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_root_key";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: key already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	 && ( internal_file->file_header->root_key_offset != 0 ) )
+	{
+		result = libregf_key_initialize(
+		          key,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->file_header->root_key_offset,
+		          internal_file->hive_bins_list,
+		          internal_file->key_item_cache,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create root key.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Walks the keys and values of the file depth first, starting at the root key
+ * The key callback is called for every key and the value callback, if not NULL, for every value of a key
+ * The data referenced by the key and value views is only valid during the callback
+ * Corrupted keys and values are skipped and mark the file as corrupted, see libregf_file_is_corrupted
+ * A callback returns 1 to continue, 0 to skip the remaining values or the sub keys and values of a key or -1 to stop with an error
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_walk(
+     libregf_file_t *file,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_walk";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	 && ( internal_file->file_header->root_key_offset != 0 ) )
+	{
+		result = libregf_key_tree_walk(
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->hive_bins_list,
+		          internal_file->file_header->root_key_offset,
+		          key_callback,
+		          value_callback,
+		          user_data,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk key tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Walks the keys and values of the file, starting at the root key, using multiple threads
+ * The file must be frozen, see libregf_file_freeze
+ * Every thread walks a part of the key tree and takes keys queued by other threads when it has no keys left
+ * The callbacks called by a thread receive the user data of the thread, user_data[ thread_index ], if user_data is not NULL
+ * The keys are not visited in a specific order
+ * The data referenced by the key and value views is only valid during the callback
+ * Corrupted keys and values are skipped and mark the file as corrupted, see libregf_file_is_corrupted
+ * A callback returns 1 to continue, 0 to skip the remaining values or the sub keys and values of a key or -1 to stop with an error
+ * If multi-threading is not supported the keys are walked by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_walk_parallel(
+     libregf_file_t *file,
+     int number_of_threads,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void **user_data,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_walk_parallel";
+	int result                             = 1;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	libregf_walk_scheduler_t *scheduler    = NULL;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBREGF_MAXIMUM_NUMBER_OF_WALK_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	 && ( internal_file->file_header->root_key_offset != 0 ) )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libregf_walk_scheduler_initialize(
+		     &scheduler,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     internal_file->hive_bins_list,
+		     number_of_threads,
+		     key_callback,
+		     value_callback,
+		     user_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create walk scheduler.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			if( libregf_walk_scheduler_run(
+			     scheduler,
+			     internal_file->file_header->root_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to walk key tree.",
+				 function );
+
+				result = -1;
+			}
+			if( libregf_walk_scheduler_free(
+			     &scheduler,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free walk scheduler.",
+				 function );
+
+				result = -1;
+			}
+		}
+#else
+		result = libregf_key_tree_walk(
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->hive_bins_list,
+		          internal_file->file_header->root_key_offset,
+		          key_callback,
+		          value_callback,
+		          ( user_data != NULL ) ? user_data[ 0 ] : NULL,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk key tree.",
+			 function );
+
+			result = -1;
+		}
+#endif /* defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) */
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1372,16 +3334,27 @@ int libregf_file_is_corrupted(
 	return( result );
 }
 
-/* Retrieves the file ASCII codepage
+/* Scans the keys and values of the file in the order of the named key cells in the file
+ * The key callback is called for every allocated named key and the value callback, if not NULL, for every value of the key
+ * The data referenced by the key and value views is only valid during the callback
+ * Corrupted keys and values are skipped and mark the file as corrupted, see libregf_file_is_corrupted
+ * A callback returns 1 to continue, 0 to skip the remaining values or the values of a key or -1 to stop with an error
  * Returns 1 if successful or -1 on error
  */
-int libregf_file_get_ascii_codepage(
+int libregf_file_scan(
      libregf_file_t *file,
-     int *ascii_codepage,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_get_ascii_codepage";
+	static char *function                  = "libregf_file_scan";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -1396,24 +3369,24 @@ int libregf_file_get_ascii_codepage(
 	}
 	internal_file = (libregf_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file header.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( key_callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 "%s: invalid key callback.",
 		 function );
 
 		return( -1 );
@@ -1433,8 +3406,29 @@ int libregf_file_get_ascii_codepage(
 		return( -1 );
 	}
 #endif
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+	if( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	{
+		result = libregf_key_tree_scan(
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->hive_bins_list,
+		          key_callback,
+		          value_callback,
+		          user_data,
+		          error );
 
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan key tree.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1450,19 +3444,22 @@ int libregf_file_get_ascii_codepage(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Sets the file ASCII codepage
+/* Retrieves the size of the key path index
+ * The key path index contains the key paths resolved since the file was opened
+ * and is only valid for the current state of the file
  * Returns 1 if successful or -1 on error
  */
-int libregf_file_set_ascii_codepage(
+int libregf_file_get_key_path_index_size(
      libregf_file_t *file,
-     int ascii_codepage,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_set_ascii_codepage";
+	static char *function                  = "libregf_file_get_key_path_index_size";
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -1477,44 +3474,30 @@ int libregf_file_set_ascii_codepage(
 	}
 	internal_file = (libregf_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file header.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBREGF_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBREGF_CODEPAGE_WINDOWS_1258 ) )
+	if( internal_file->key_path_cache == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key path cache.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1522,16 +3505,30 @@ int libregf_file_set_ascii_codepage(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
+	result = libregf_key_path_cache_get_index_data_size(
+	          internal_file->key_path_cache,
+	          data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key path index data size.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1539,26 +3536,28 @@ int libregf_file_set_ascii_codepage(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the format version
+/* Copies the key path index to the data
+ * Use libregf_file_get_key_path_index_size to determine the size of the data
  * Returns 1 if successful or -1 on error
  */
-int libregf_file_get_format_version(
+int libregf_file_copy_key_path_index(
      libregf_file_t *file,
-     uint32_t *major_version,
-     uint32_t *minor_version,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_get_format_version";
+	static char *function                  = "libregf_file_copy_key_path_index";
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -1584,24 +3583,13 @@ int libregf_file_get_format_version(
 
 		return( -1 );
 	}
-	if( major_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major format version.",
-		 function );
-
-		return( -1 );
-	}
-	if( minor_version == NULL )
+	if( internal_file->key_path_cache == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key path cache.",
 		 function );
 
 		return( -1 );
@@ -1621,9 +3609,24 @@ int libregf_file_get_format_version(
 		return( -1 );
 	}
 #endif
-	*major_version = internal_file->file_header->major_format_version;
-	*minor_version = internal_file->file_header->minor_format_version;
+	result = libregf_key_path_cache_write_index_data(
+	          internal_file->key_path_cache,
+	          internal_file->file_header,
+	          data,
+	          data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy key path index.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1639,19 +3642,23 @@ int libregf_file_get_format_version(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the type
- * Returns 1 if successful or -1 on error
+/* Sets the key path index from the data
+ * The key path index should have been copied from a previous open of the same file
+ * None of the entries of a truncated or corrupted key path index are used
+ * Returns 1 if successful, 0 if the key path index is for another file or another state of the file or -1 on error
  */
-int libregf_file_get_type(
+int libregf_file_set_key_path_index(
      libregf_file_t *file,
-     uint32_t *file_type,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_get_type";
+	static char *function                  = "libregf_file_set_key_path_index";
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -1677,13 +3684,13 @@ int libregf_file_get_type(
 
 		return( -1 );
 	}
-	if( file_type == NULL )
+	if( internal_file->key_path_cache == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key path cache.",
 		 function );
 
 		return( -1 );
@@ -1703,8 +3710,24 @@ int libregf_file_get_type(
 		return( -1 );
 	}
 #endif
-	*file_type = internal_file->file_header->file_type;
+	result = libregf_key_path_cache_read_index_data(
+	          internal_file->key_path_cache,
+	          internal_file->file_header,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key path index.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1720,20 +3743,23 @@ int libregf_file_get_type(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the root key
+/* Retrieves the key for the specific UTF-8 encoded path
+ * The path separator is the \ character
  * Creates a new key
  * Returns 1 if successful, 0 if no such key or -1 on error
  */
-int libregf_file_get_root_key(
+int libregf_file_get_key_by_utf8_path(
      libregf_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      libregf_key_t **key,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_get_root_key";
+	static char *function                  = "libregf_file_get_key_by_utf8_path";
 	int result                             = 0;
 
 	if( file == NULL )
@@ -1760,6 +3786,28 @@ int libregf_file_get_root_key(
 
 		return( -1 );
 	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1783,7 +3831,7 @@ int libregf_file_get_root_key(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1791,37 +3839,40 @@ int libregf_file_get_root_key(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( ( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
-	 && ( internal_file->file_header->root_key_offset != 0 ) )
+	if( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
 	{
-		result = libregf_key_initialize(
-		          key,
+		result = libregf_key_tree_get_sub_key_by_utf8_path(
 		          internal_file->io_handle,
 		          internal_file->file_io_handle,
-		          internal_file->file_header->root_key_offset,
 		          internal_file->hive_bins_list,
-		          error );
+		          internal_file->key_item_cache,
+		          internal_file->key_path_cache,
+		          internal_file->file_header->root_key_offset,
+		          utf8_string,
+		          utf8_string_length,
+		          key,
+			  error );
 
-		if( result != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create root key.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key by UTF-8 path.",
 			 function );
 
 			result = -1;
 		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1829,7 +3880,7 @@ int libregf_file_get_root_key(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1838,21 +3889,25 @@ int libregf_file_get_root_key(
 	return( result );
 }
 
-/* Retrieves the key for the specific UTF-8 encoded path
+/* Retrieves the keys for specific UTF-8 encoded paths
  * The path separator is the \ character
- * Creates a new key
- * Returns 1 if successful, 0 if no such key or -1 on error
+ * Paths that share leading segments are resolved together, so that every
+ * shared intermediate key is read once
+ * Creates a new key for every path that was found and sets the key of a path
+ * that was not found to NULL
+ * Returns 1 if successful or -1 on error
  */
-int libregf_file_get_key_by_utf8_path(
+int libregf_file_get_keys_by_utf8_paths(
      libregf_file_t *file,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libregf_key_t **key,
+     const uint8_t **utf8_strings,
+     size_t *utf8_string_lengths,
+     int number_of_paths,
+     libregf_key_t **keys,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_get_key_by_utf8_path";
-	int result                             = 0;
+	static char *function                  = "libregf_file_get_keys_by_utf8_paths";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -1878,52 +3933,52 @@ int libregf_file_get_key_by_utf8_path(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( utf8_strings == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid UTF-8 strings.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+	if( utf8_string_lengths == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
 		 function );
 
 		return( -1 );
 	}
-	if( key == NULL )
+	if( number_of_paths <= 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of paths value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-	if( *key != NULL )
+	if( keys == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: key already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1931,7 +3986,7 @@ int libregf_file_get_key_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1939,30 +3994,32 @@ int libregf_file_get_key_by_utf8_path(
 #endif
 	if( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
 	{
-		result = libregf_key_tree_get_sub_key_by_utf8_path(
+		result = libregf_key_tree_get_sub_keys_by_utf8_paths(
 		          internal_file->io_handle,
 		          internal_file->file_io_handle,
 		          internal_file->hive_bins_list,
+		          internal_file->key_item_cache,
 		          internal_file->file_header->root_key_offset,
-		          utf8_string,
-		          utf8_string_length,
-		          key,
-			  error );
+		          utf8_strings,
+		          utf8_string_lengths,
+		          number_of_paths,
+		          keys,
+		          error );
 
-		if( result == -1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key by UTF-8 path.",
+			 "%s: unable to retrieve keys by UTF-8 paths.",
 			 function );
 
 			result = -1;
 		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1970,7 +4027,7 @@ int libregf_file_get_key_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2064,7 +4121,7 @@ int libregf_file_get_key_by_utf16_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2072,7 +4129,7 @@ int libregf_file_get_key_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2084,6 +4141,8 @@ int libregf_file_get_key_by_utf16_path(
 		          internal_file->io_handle,
 		          internal_file->file_io_handle,
 		          internal_file->hive_bins_list,
+		          internal_file->key_item_cache,
+		          internal_file->key_path_cache,
 		          internal_file->file_header->root_key_offset,
 		          utf16_string,
 		          utf16_string_length,
@@ -2103,7 +4162,7 @@ int libregf_file_get_key_by_utf16_path(
 		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2111,7 +4170,7 @@ int libregf_file_get_key_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
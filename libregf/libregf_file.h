@@ -30,11 +30,14 @@
 #include "libregf_file_header.h"
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_key_path_cache.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
+#include "libregf_memory_map.h"
 #include "libregf_types.h"
 
 #if defined( __cplusplus )
@@ -65,6 +68,26 @@ struct libregf_internal_file
 	 */
 	libregf_hive_bins_list_t *hive_bins_list;
 
+	/* The key item cache, which contains the key items by their key offset
+	 */
+	libregf_key_item_cache_t *key_item_cache;
+
+	/* The key path cache, which contains the key offsets of previously resolved key paths
+	 */
+	libregf_key_path_cache_t *key_path_cache;
+
+	/* The memory map, which is set when the file is memory mapped
+	 */
+	libregf_memory_map_t *memory_map;
+
+	/* The file data, which is set when the file is accessed in memory
+	 */
+	const uint8_t *file_data;
+
+	/* The file data size
+	 */
+	size_t file_data_size;
+
 	/* Value to indicate if the file IO handle was created inside the library
 	 */
 	uint8_t file_io_handle_created_in_library;
@@ -124,11 +147,26 @@ int libregf_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_open_memory(
+     libregf_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_file_close(
      libregf_file_t *file,
      libcerror_error_t **error );
 
+int libregf_internal_file_open_data(
+     libregf_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 int libregf_internal_file_open_read(
      libregf_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
@@ -161,6 +199,47 @@ int libregf_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_get_maximum_number_of_cached_hive_bins(
+     libregf_file_t *file,
+     int *maximum_number_of_cached_hive_bins,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_set_maximum_number_of_cached_hive_bins(
+     libregf_file_t *file,
+     int maximum_number_of_cached_hive_bins,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_get_maximum_number_of_cached_values(
+     libregf_file_t *file,
+     int *maximum_number_of_cached_values,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_set_maximum_number_of_cached_values(
+     libregf_file_t *file,
+     int maximum_number_of_cached_values,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_get_statistic(
+     libregf_file_t *file,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_reset_statistics(
+     libregf_file_t *file,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_freeze(
+     libregf_file_t *file,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_file_get_format_version(
      libregf_file_t *file,
@@ -180,6 +259,63 @@ int libregf_file_get_root_key(
      libregf_key_t **key,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_walk(
+     libregf_file_t *file,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_walk_parallel(
+     libregf_file_t *file,
+     int number_of_threads,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void **user_data,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_scan(
+     libregf_file_t *file,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_get_key_path_index_size(
+     libregf_file_t *file,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_copy_key_path_index(
+     libregf_file_t *file,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_set_key_path_index(
+     libregf_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_file_get_key_by_utf8_path(
      libregf_file_t *file,
@@ -188,6 +324,15 @@ int libregf_file_get_key_by_utf8_path(
      libregf_key_t **key,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_get_keys_by_utf8_paths(
+     libregf_file_t *file,
+     const uint8_t **utf8_strings,
+     size_t *utf8_string_lengths,
+     int number_of_paths,
+     libregf_key_t **keys,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_file_get_key_by_utf16_path(
      libregf_file_t *file,
@@ -247,6 +247,14 @@ int libregf_file_header_read_data(
 
 		return( -1 );
 	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_file_header_t *) data )->primary_sequence_number,
+	 file_header->primary_sequence_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_file_header_t *) data )->secondary_sequence_number,
+	 file_header->secondary_sequence_number );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (regf_file_header_t *) data )->major_format_version,
 	 file_header->major_format_version );
@@ -267,6 +275,8 @@ int libregf_file_header_read_data(
 	 ( (regf_file_header_t *) data )->hive_bins_size,
 	 file_header->hive_bins_size );
 
+	file_header->checksum = stored_xor32_checksum;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
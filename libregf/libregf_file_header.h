@@ -36,6 +36,14 @@ typedef struct libregf_file_header libregf_file_header_t;
 
 struct libregf_file_header
 {
+	/* The primary sequence number
+	 */
+	uint32_t primary_sequence_number;
+
+	/* The secondary sequence number
+	 */
+	uint32_t secondary_sequence_number;
+
 	/* The major format version
 	 */
 	uint32_t major_format_version;
@@ -55,6 +63,10 @@ struct libregf_file_header
 	/* The hive bins size
 	 */
 	uint32_t hive_bins_size;
+
+	/* The checksum
+	 */
+	uint32_t checksum;
 };
 
 int libregf_file_header_initialize(
@@ -30,13 +30,29 @@
 #include "libregf_hive_bin_cell.h"
 #include "libregf_hive_bin_header.h"
 #include "libregf_libbfio.h"
-#include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfdatetime.h"
 
 #include "regf_hive_bin.h"
 
+#if defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+#define libregf_hive_bin_references_increment( number_of_references ) \
+	__atomic_add_fetch( &( number_of_references ), 1, __ATOMIC_RELAXED )
+
+#define libregf_hive_bin_references_decrement( number_of_references ) \
+	__atomic_sub_fetch( &( number_of_references ), 1, __ATOMIC_ACQ_REL )
+
+#else
+#define libregf_hive_bin_references_increment( number_of_references ) \
+	++( number_of_references )
+
+#define libregf_hive_bin_references_decrement( number_of_references ) \
+	--( number_of_references )
+
+#endif /* defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES ) */
+
 /* Creates a hive bin
  * Make sure the value hive_bin is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -104,22 +120,24 @@ int libregf_hive_bin_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *hive_bin )->cells_array ),
-	     0,
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+	if( libcthreads_mutex_initialize(
+	     &( ( *hive_bin )->mutex ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create cells array.",
+		 "%s: unable to initialize mutex.",
 		 function );
 
 		goto on_error;
 	}
-	( *hive_bin )->offset = offset;
-	( *hive_bin )->size   = size;
+#endif
+	( *hive_bin )->offset               = offset;
+	( *hive_bin )->size                 = size;
+	( *hive_bin )->number_of_references = 1;
 
 	return( 1 );
 
@@ -135,14 +153,16 @@ on_error:
 }
 
 /* Frees a hive bin
+ * This releases a reference to the hive bin, the hive bin is freed when the last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libregf_hive_bin_free(
      libregf_hive_bin_t **hive_bin,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bin_free";
-	int result            = 1;
+	static char *function    = "libregf_hive_bin_free";
+	int number_of_references = 0;
+	int result               = 1;
 
 	if( hive_bin == NULL )
 	{
@@ -157,21 +177,71 @@ int libregf_hive_bin_free(
 	}
 	if( *hive_bin != NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *hive_bin )->cells_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libregf_hive_bin_cell_free,
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+		if( libcthreads_mutex_grab(
+		     ( *hive_bin )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		number_of_references = libregf_hive_bin_references_decrement(
+		                        ( *hive_bin )->number_of_references );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+		if( libcthreads_mutex_release(
+		     ( *hive_bin )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			/* The hive bin is still referenced by a hive bin cell
+			 */
+			*hive_bin = NULL;
+
+			return( 1 );
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+		if( libcthreads_mutex_free(
+		     &( ( *hive_bin )->mutex ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the hive bin cells array.",
+			 "%s: unable to free mutex.",
 			 function );
 
 			result = -1;
 		}
-		if( ( *hive_bin )->data != NULL )
+#endif
+		/* The cell sizes and flags are stored in the same allocation as the cell offsets
+		 */
+		if( ( *hive_bin )->cell_offsets != NULL )
+		{
+			memory_free(
+			 ( *hive_bin )->cell_offsets );
+		}
+		if( ( ( *hive_bin )->data != NULL )
+		 && ( ( *hive_bin )->data_is_referenced == 0 ) )
 		{
 			memory_free(
 			 ( *hive_bin )->data );
@@ -184,7 +254,66 @@ int libregf_hive_bin_free(
 	return( result );
 }
 
+/* Grabs a reference to a hive bin
+ * The reference is released by libregf_hive_bin_free
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bin_grab_reference(
+     libregf_hive_bin_t *hive_bin,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bin_grab_reference";
+
+	if( hive_bin == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+	if( libcthreads_mutex_grab(
+	     hive_bin->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libregf_hive_bin_references_increment(
+	 hive_bin->number_of_references );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+	if( libcthreads_mutex_release(
+	     hive_bin->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Reads a hive bin and determines its cells
+ * The cells are stored in a table of cell offsets, sizes and flags
+ * The cells data is not referenced, the cells refer to the hive bin data
  * Returns 1 if successful or -1 on error
  */
 int libregf_hive_bin_read_cells_data(
@@ -193,14 +322,13 @@ int libregf_hive_bin_read_cells_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
-	static char *function                  = "libregf_hive_bin_read_cells_data";
-	size_t data_offset                     = 0;
-	uint32_t cell_size                     = 0;
-	uint32_t file_offset                   = 0;
-	uint8_t flags                          = 0;
-	int cell_index                         = 0;
-	int entry_index                        = 0;
+	static char *function = "libregf_hive_bin_read_cells_data";
+	size_t data_offset    = 0;
+	uint32_t cell_size    = 0;
+	uint32_t file_offset  = 0;
+	uint8_t flags         = 0;
+	int cell_index        = 0;
+	int number_of_cells   = 0;
 
 	if( hive_bin == NULL )
 	{
@@ -248,7 +376,22 @@ int libregf_hive_bin_read_cells_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-/* TODO empty cells array */
+	/* Remove the cells table of a previous read
+	 */
+	if( hive_bin->cell_offsets != NULL )
+	{
+		memory_free(
+		 hive_bin->cell_offsets );
+
+		hive_bin->cell_offsets = NULL;
+		hive_bin->cell_sizes   = NULL;
+		hive_bin->cell_flags   = NULL;
+	}
+	hive_bin->number_of_cells = 0;
+	hive_bin->cells_read      = 0;
+
+	/* The first pass validates the cells and determines the number of cells
+	 */
 	file_offset = hive_bin->offset + sizeof( regf_hive_bin_header_t );
 
 	while( data_offset < data_size )
@@ -259,7 +402,7 @@ int libregf_hive_bin_read_cells_data(
 			libcnotify_printf(
 			 "%s: hive bin cell: %03d offset\t\t: 0x%08" PRIx32 "\n",
 			 function,
-			 cell_index,
+			 number_of_cells,
 			 file_offset );
 		}
 #endif
@@ -272,7 +415,7 @@ int libregf_hive_bin_read_cells_data(
 			 "%s: invalid cell size value exceeds hive bin size.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		byte_stream_copy_to_uint32_little_endian(
 		 &( data[ data_offset ] ),
@@ -286,13 +429,11 @@ int libregf_hive_bin_read_cells_data(
 			libcnotify_printf(
 			 "%s: hive bin cell: %03d size\t\t: 0x%08" PRIx32 " (%" PRIi32 ")\n",
 			 function,
-			 cell_index,
+			 number_of_cells,
 			 cell_size,
 			 (int32_t) cell_size );
 		}
 #endif
-		flags = 0;
-
 		if( cell_size == 0x80000000UL )
 		{
 			libcerror_error_set(
@@ -302,16 +443,12 @@ int libregf_hive_bin_read_cells_data(
 			 "%s: invalid cell size value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( (int32_t) cell_size < 0 )
 		{
 			cell_size = (uint32_t) ( -1 * (int32_t) cell_size );
 		}
-		else
-		{
-			flags |= LIBREGF_HIVE_BIN_CELL_FLAG_UNALLOCATED;
-		}
 		if( cell_size < 4 )
 		{
 			libcerror_error_set(
@@ -321,7 +458,7 @@ int libregf_hive_bin_read_cells_data(
 			 "%s: invalid cell size value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( ( cell_size % 8 ) != 0 )
 		{
@@ -332,7 +469,7 @@ int libregf_hive_bin_read_cells_data(
 			 "%s: invalid cell size value should be multitude of 8.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		/* Remove the size of the cell size value
 		 */
@@ -347,7 +484,7 @@ int libregf_hive_bin_read_cells_data(
 			 "%s: invalid cell size value exceeds hive bin size.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -355,79 +492,88 @@ int libregf_hive_bin_read_cells_data(
 			libcnotify_printf(
 			 "%s: hive bin cell: %03d data:\n",
 			 function,
-			 cell_index );
+			 number_of_cells );
 			libcnotify_print_data(
 			 &( data[ data_offset ] ),
 			 cell_size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif
-		if( libregf_hive_bin_cell_initialize(
-		     &hive_bin_cell,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create hive bin cell.",
-			 function );
-
-			goto on_error;
-		}
-		hive_bin_cell->offset = (uint32_t) file_offset;
-		hive_bin_cell->data   = &( data[ data_offset ] );
-		hive_bin_cell->size   = cell_size;
-		hive_bin_cell->flags |= flags;
-
 		data_offset += cell_size;
 		file_offset += 4 + cell_size;
 
-		if( libcdata_array_append_entry(
-		     hive_bin->cells_array,
-		     &entry_index,
-		     (intptr_t *) hive_bin_cell,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append hive bin cell: %d.",
-			 function,
-			 cell_index );
+		number_of_cells++;
+	}
+/* TODO check cell offset == bin size */
 
-			goto on_error;
-		}
-		hive_bin_cell = NULL;
+	/* The cell offsets, sizes and flags are stored in a single allocation
+	 */
+	hive_bin->cell_offsets = (uint32_t *) memory_allocate(
+	                                       ( sizeof( uint32_t ) + sizeof( uint32_t ) + sizeof( uint8_t ) ) * number_of_cells );
+
+	if( hive_bin->cell_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cells table.",
+		 function );
 
-		cell_index++;
+		return( -1 );
 	}
-/* TODO check cell offset == bin size */
+	hive_bin->cell_sizes = &( hive_bin->cell_offsets[ number_of_cells ] );
+	hive_bin->cell_flags = (uint8_t *) &( hive_bin->cell_sizes[ number_of_cells ] );
 
-	return( 1 );
+	/* The second pass fills the cells table
+	 */
+	data_offset = 0;
+	file_offset = hive_bin->offset + sizeof( regf_hive_bin_header_t );
 
-on_error:
-	if( hive_bin_cell != NULL )
+	for( cell_index = 0;
+	     cell_index < number_of_cells;
+	     cell_index++ )
 	{
-		libregf_hive_bin_cell_free(
-		 &hive_bin_cell,
-		 NULL );
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 cell_size );
+
+		flags = 0;
+
+		if( (int32_t) cell_size < 0 )
+		{
+			cell_size = (uint32_t) ( -1 * (int32_t) cell_size );
+		}
+		else
+		{
+			flags |= LIBREGF_HIVE_BIN_CELL_FLAG_UNALLOCATED;
+		}
+		hive_bin->cell_offsets[ cell_index ] = file_offset;
+		hive_bin->cell_sizes[ cell_index ]   = cell_size - 4;
+		hive_bin->cell_flags[ cell_index ]   = flags;
+
+		data_offset += cell_size;
+		file_offset += cell_size;
 	}
-/* TODO empty cells array */
-	return( -1 );
+	hive_bin->number_of_cells          = number_of_cells;
+	hive_bin->cells_read               = 1;
+	hive_bin->cells_table_is_corrupted = 0;
+
+	return( 1 );
 }
 
-/* Reads a hive bin and determines its cells
+/* Sets the hive bin (cells) data
+ * The data is referenced and not copied, it must remain available for the lifetime of the hive bin
+ * The cells are not determined, use libregf_hive_bin_read_cells_data for that
  * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bin_read_cells_file_io_handle(
+int libregf_hive_bin_set_data(
      libregf_hive_bin_t *hive_bin,
-     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bin_read_cells_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function = "libregf_hive_bin_set_data";
 
 	if( hive_bin == NULL )
 	{
@@ -440,13 +586,70 @@ int libregf_hive_bin_read_cells_file_io_handle(
 
 		return( -1 );
 	}
-	if( hive_bin->cells_array == NULL )
+	if( hive_bin->data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bin - missing cells array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hive bin - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hive_bin->size <= sizeof( regf_hive_bin_header_t ) )
+	 || ( data_size != ( (size_t) hive_bin->size - sizeof( regf_hive_bin_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bin->data               = (uint8_t *) data;
+	hive_bin->data_size          = data_size;
+	hive_bin->data_is_referenced = 1;
+
+	return( 1 );
+}
+
+/* Reads the hive bin (cells) data
+ * The data is read at the file offset, which is the offset of the hive bin header
+ * plus the size of the hive bin header, so that the read does not depend on the
+ * current offset of the file IO handle
+ * The cells are not determined, use libregf_hive_bin_read_cells_data for that
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bin_read_data_file_io_handle(
+     libregf_hive_bin_t *hive_bin,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bin_read_data_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( hive_bin == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin.",
 		 function );
 
 		return( -1 );
@@ -462,7 +665,7 @@ int libregf_hive_bin_read_cells_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( hive_bin->size == 0 )
+	if( ( hive_bin->size <= sizeof( regf_hive_bin_header_t ) )
 	 || ( hive_bin->size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
@@ -490,13 +693,68 @@ int libregf_hive_bin_read_cells_file_io_handle(
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer(
+	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              hive_bin->data,
 	              hive_bin->data_size,
+	              file_offset,
 	              error );
 
 	if( read_count != (ssize_t) hive_bin->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bin cells data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( hive_bin->data != NULL )
+	{
+		memory_free(
+		 hive_bin->data );
+
+		hive_bin->data = NULL;
+	}
+	hive_bin->data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads a hive bin and determines its cells
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bin_read_cells_file_io_handle(
+     libregf_hive_bin_t *hive_bin,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bin_read_cells_file_io_handle";
+
+	if( hive_bin == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bin_read_data_file_io_handle(
+	     hive_bin,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -537,16 +795,22 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of hive bin cells
- * Returns 1 if successful or -1 on error
+/* Reads the hive bin cell at the offset on demand
+ * The sizes of the preceding cells are read to determine the offset is the start of a cell,
+ * the cells table is not created
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libregf_hive_bin_get_number_of_cells(
+int libregf_hive_bin_read_cell_at_offset(
      libregf_hive_bin_t *hive_bin,
-     uint16_t *number_of_cells,
+     uint32_t cell_offset,
+     libregf_hive_bin_cell_t *hive_bin_cell,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bin_get_number_of_cells";
-	int number_of_entries = 0;
+	static char *function   = "libregf_hive_bin_read_cell_at_offset";
+	size_t cell_data_offset = 0;
+	size_t data_offset      = 0;
+	uint32_t cell_size      = 0;
+	uint8_t flags           = 0;
 
 	if( hive_bin == NULL )
 	{
@@ -559,57 +823,173 @@ int libregf_hive_bin_get_number_of_cells(
 
 		return( -1 );
 	}
-	if( number_of_cells == NULL )
+	if( hive_bin->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bin - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_cell == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of cells.",
+		 "%s: invalid hive bin cell.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     hive_bin->cells_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	if( cell_offset < ( hive_bin->offset + sizeof( regf_hive_bin_header_t ) ) )
+	{
+		return( 0 );
+	}
+	data_offset = (size_t) ( cell_offset - hive_bin->offset - sizeof( regf_hive_bin_header_t ) );
+
+	/* Cells are aligned to 8 bytes relative to the start of the hive bin
+	 */
+	if( ( ( data_offset % 8 ) != 0 )
+	 || ( data_offset >= hive_bin->data_size )
+	 || ( ( hive_bin->data_size - data_offset ) < 4 ) )
+	{
+		return( 0 );
+	}
+	/* Only an offset at the start of a cell is valid, hence the cell boundaries
+	 * are followed from the start of the hive bin up to the offset
+	 */
+	while( cell_data_offset < data_offset )
+	{
+		if( ( hive_bin->data_size - cell_data_offset ) < 4 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( hive_bin->data[ cell_data_offset ] ),
+		 cell_size );
+
+		if( cell_size == 0x80000000UL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid cell size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (int32_t) cell_size < 0 )
+		{
+			cell_size = (uint32_t) ( -1 * (int32_t) cell_size );
+		}
+		if( ( cell_size < 8 )
+		 || ( ( cell_size % 8 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid cell size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) cell_size > ( hive_bin->data_size - cell_data_offset ) )
+		{
+			return( 0 );
+		}
+		cell_data_offset += cell_size;
+	}
+	if( cell_data_offset != data_offset )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( hive_bin->data[ data_offset ] ),
+	 cell_size );
+
+	data_offset += 4;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: hive bin cell: 0x%08" PRIx32 " size\t: 0x%08" PRIx32 " (%" PRIi32 ")\n",
+		 function,
+		 cell_offset,
+		 cell_size,
+		 (int32_t) cell_size );
+	}
+#endif
+	if( cell_size == 0x80000000UL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cell size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_entries > (int) UINT16_MAX )
+	if( (int32_t) cell_size < 0 )
+	{
+		cell_size = (uint32_t) ( -1 * (int32_t) cell_size );
+	}
+	else
+	{
+		flags |= LIBREGF_HIVE_BIN_CELL_FLAG_UNALLOCATED;
+	}
+	if( ( cell_size < 4 )
+	 || ( ( cell_size % 8 ) != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of entries value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cell size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	*number_of_cells = (uint16_t) number_of_entries;
+	/* Remove the size of the cell size value
+	 */
+	cell_size -= 4;
+
+	if( cell_size > ( hive_bin->data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cell size value exceeds hive bin size.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bin_cell->offset    = cell_offset;
+	hive_bin_cell->data      = &( hive_bin->data[ data_offset ] );
+	hive_bin_cell->hive_bin  = NULL;
+	hive_bin_cell->size      = cell_size;
+	hive_bin_cell->flags     = flags;
 
 	return( 1 );
 }
 
-/* Retrieves the hive bin cell at the index
+/* Retrieves the number of hive bin cells
  * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bin_get_cell(
+int libregf_hive_bin_get_number_of_cells(
      libregf_hive_bin_t *hive_bin,
-     uint16_t cell_index,
-     libregf_hive_bin_cell_t **hive_bin_cell,
+     uint16_t *number_of_cells,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bin_get_cell";
+	static char *function = "libregf_hive_bin_get_number_of_cells";
 
 	if( hive_bin == NULL )
 	{
@@ -622,37 +1002,62 @@ int libregf_hive_bin_get_cell(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     hive_bin->cells_array,
-	     (int) cell_index,
-	     (intptr_t **) hive_bin_cell,
-	     error ) != 1 )
+	if( number_of_cells == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin cell: %" PRIu16 ".",
-		 function,
-		 cell_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cells.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin->cells_read == 0 )
+	{
+		if( libregf_hive_bin_read_cells_data(
+		     hive_bin,
+		     hive_bin->data,
+		     hive_bin->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin cells.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( hive_bin->number_of_cells > (int) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of cells value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
+	*number_of_cells = (uint16_t) hive_bin->number_of_cells;
+
 	return( 1 );
 }
 
-/* Retrieves the hive bin cell at the offset
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the hive bin cell at the index
+ * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bin_get_cell_at_offset(
+int libregf_hive_bin_get_cell(
      libregf_hive_bin_t *hive_bin,
-     uint32_t cell_offset,
-     libregf_hive_bin_cell_t **hive_bin_cell,
+     uint16_t cell_index,
+     libregf_hive_bin_cell_t *hive_bin_cell,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bin_get_cell_at_offset";
-	int entry_index       = 0;
-	int number_of_entries = 0;
+	static char *function = "libregf_hive_bin_get_cell";
+	size_t data_offset    = 0;
 
 	if( hive_bin == NULL )
 	{
@@ -665,13 +1070,13 @@ int libregf_hive_bin_get_cell_at_offset(
 
 		return( -1 );
 	}
-	if( hive_bin->cells_array == NULL )
+	if( hive_bin->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bin - missing cells array.",
+		 "%s: invalid hive bin - missing data.",
 		 function );
 
 		return( -1 );
@@ -687,47 +1092,193 @@ int libregf_hive_bin_get_cell_at_offset(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     hive_bin->cells_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	if( hive_bin->cells_read == 0 )
+	{
+		if( libregf_hive_bin_read_cells_data(
+		     hive_bin,
+		     hive_bin->data,
+		     hive_bin->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin cells.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( (int) cell_index >= hive_bin->number_of_cells )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve the number of hive bin cells.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cell index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	data_offset = (size_t) ( hive_bin->cell_offsets[ cell_index ] - hive_bin->offset - sizeof( regf_hive_bin_header_t ) ) + 4;
+
+	hive_bin_cell->offset    = hive_bin->cell_offsets[ cell_index ];
+	hive_bin_cell->data      = &( hive_bin->data[ data_offset ] );
+	hive_bin_cell->hive_bin  = NULL;
+	hive_bin_cell->size      = hive_bin->cell_sizes[ cell_index ];
+	hive_bin_cell->flags     = hive_bin->cell_flags[ cell_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the hive bin cell at the offset
+ * The cells table is read on the first lookup and a binary search is used on the cell offsets,
+ * the cell is only read on demand if the cells table cannot be read
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libregf_hive_bin_get_cell_at_offset(
+     libregf_hive_bin_t *hive_bin,
+     uint32_t cell_offset,
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bin_get_cell_at_offset";
+	size_t data_offset    = 0;
+	int cell_index        = 0;
+	int lower_cell_index  = 0;
+	int result            = 0;
+	int upper_cell_index  = 0;
+
+	if( hive_bin == NULL )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     hive_bin->cells_array,
-		     entry_index,
-		     (intptr_t **) hive_bin_cell,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin cell.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cell_offset < ( hive_bin->offset + sizeof( regf_hive_bin_header_t ) ) )
+	 || ( ( cell_offset - hive_bin->offset ) >= hive_bin->size ) )
+	{
+		return( 0 );
+	}
+	if( ( hive_bin->cells_read == 0 )
+	 && ( hive_bin->cells_table_is_corrupted == 0 ) )
+	{
+		if( hive_bin->data == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve hive bin cell: %d.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid hive bin - missing data.",
+			 function );
+
+			return( -1 );
+		}
+		/* Following the cell boundaries up to the offset on every lookup is linear
+		 * in the number of cells, hence the cells table is read once
+		 */
+		if( libregf_hive_bin_read_cells_data(
+		     hive_bin,
+		     hive_bin->data,
+		     hive_bin->data_size,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			/* The cells that precede a corrupted cell can still be read on demand
+			 */
+			hive_bin->cells_table_is_corrupted = 1;
+		}
+	}
+	if( hive_bin->cells_read == 0 )
+	{
+		result = libregf_hive_bin_read_cell_at_offset(
+		          hive_bin,
+		          cell_offset,
+		          hive_bin_cell,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin cell at offset: 0x%08" PRIx32 ".",
 			 function,
-			 entry_index );
+			 cell_offset );
 
 			return( -1 );
 		}
-		if( ( *hive_bin_cell )->offset == cell_offset )
+		return( result );
+	}
+	if( hive_bin->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bin - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	upper_cell_index = hive_bin->number_of_cells;
+
+	while( lower_cell_index < upper_cell_index )
+	{
+		cell_index = lower_cell_index + ( ( upper_cell_index - lower_cell_index ) / 2 );
+
+		if( cell_offset == hive_bin->cell_offsets[ cell_index ] )
 		{
+			data_offset = (size_t) ( cell_offset - hive_bin->offset - sizeof( regf_hive_bin_header_t ) ) + 4;
+
+			hive_bin_cell->offset    = cell_offset;
+			hive_bin_cell->data      = &( hive_bin->data[ data_offset ] );
+			hive_bin_cell->hive_bin  = NULL;
+			hive_bin_cell->size      = hive_bin->cell_sizes[ cell_index ];
+			hive_bin_cell->flags     = hive_bin->cell_flags[ cell_index ];
+
 			return( 1 );
 		}
+		if( cell_offset < hive_bin->cell_offsets[ cell_index ] )
+		{
+			upper_cell_index = cell_index;
+		}
+		else
+		{
+			lower_cell_index = cell_index + 1;
+		}
 	}
-	*hive_bin_cell = NULL;
-
 	return( 0 );
 }
 
@@ -27,13 +27,20 @@
 
 #include "libregf_hive_bin_cell.h"
 #include "libregf_libbfio.h"
-#include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The number of references is updated with atomic operations when the compiler
+ * provides lock-free 32-bit atomic operations, otherwise while holding the mutex
+ */
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ ) && defined( __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 ) && defined( __ATOMIC_ACQ_REL )
+#define LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES
+#endif
+
 typedef struct libregf_hive_bin libregf_hive_bin_t;
 
 struct libregf_hive_bin
@@ -54,9 +61,43 @@ struct libregf_hive_bin
 	 */
 	size_t data_size;
 
-	/* The hive bin cells array
+	/* Value to indicate the data is referenced and not managed by the hive bin
+	 */
+	uint8_t data_is_referenced;
+
+	/* The cell offsets
+	 */
+	uint32_t *cell_offsets;
+
+	/* The cell sizes
+	 */
+	uint32_t *cell_sizes;
+
+	/* The cell flags
+	 */
+	uint8_t *cell_flags;
+
+	/* The number of cells
+	 */
+	int number_of_cells;
+
+	/* Value to indicate all the cells were read
+	 */
+	uint8_t cells_read;
+
+	/* Value to indicate the cells could not be read into the cells table
+	 */
+	uint8_t cells_table_is_corrupted;
+
+	/* The number of references, the hive bin is freed when the last reference is released
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BIN_HAVE_ATOMIC_REFERENCES )
+	/* The mutex, which serializes access to the number of references
 	 */
-	libcdata_array_t *cells_array;
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int libregf_hive_bin_initialize(
@@ -69,15 +110,38 @@ int libregf_hive_bin_free(
      libregf_hive_bin_t **hive_bin,
      libcerror_error_t **error );
 
+int libregf_hive_bin_grab_reference(
+     libregf_hive_bin_t *hive_bin,
+     libcerror_error_t **error );
+
 int libregf_hive_bin_read_cells_data(
      libregf_hive_bin_t *hive_bin,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+int libregf_hive_bin_set_data(
+     libregf_hive_bin_t *hive_bin,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libregf_hive_bin_read_data_file_io_handle(
+     libregf_hive_bin_t *hive_bin,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libregf_hive_bin_read_cells_file_io_handle(
      libregf_hive_bin_t *hive_bin,
      libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libregf_hive_bin_read_cell_at_offset(
+     libregf_hive_bin_t *hive_bin,
+     uint32_t cell_offset,
+     libregf_hive_bin_cell_t *hive_bin_cell,
      libcerror_error_t **error );
 
 int libregf_hive_bin_get_number_of_cells(
@@ -88,13 +152,13 @@ int libregf_hive_bin_get_number_of_cells(
 int libregf_hive_bin_get_cell(
      libregf_hive_bin_t *hive_bin,
      uint16_t cell_index,
-     libregf_hive_bin_cell_t **hive_bin_cell,
+     libregf_hive_bin_cell_t *hive_bin_cell,
      libcerror_error_t **error );
 
 int libregf_hive_bin_get_cell_at_offset(
      libregf_hive_bin_t *hive_bin,
      uint32_t cell_offset,
-     libregf_hive_bin_cell_t **hive_bin_cell,
+     libregf_hive_bin_cell_t *hive_bin_cell,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
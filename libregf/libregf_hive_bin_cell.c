@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libregf_hive_bin.h"
 #include "libregf_hive_bin_cell.h"
 #include "libregf_libcerror.h"
 
@@ -108,6 +109,7 @@ int libregf_hive_bin_cell_free(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_hive_bin_cell_free";
+	int result            = 1;
 
 	if( hive_bin_cell == NULL )
 	{
@@ -125,11 +127,116 @@ int libregf_hive_bin_cell_free(
 		/* The hive bin cell data is referenced
 		 * and maintained by the hive bin
 		 */
+		if( libregf_hive_bin_cell_free_data(
+		     *hive_bin_cell,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hive bin cell data.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *hive_bin_cell );
 
 		*hive_bin_cell = NULL;
 	}
+	return( result );
+}
+
+/* References the hive bin that contains the hive bin cell
+ * This keeps the hive bin cell data available when the hive bin is evicted from the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bin_cell_reference_hive_bin(
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libregf_hive_bin_t *hive_bin,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bin_cell_reference_hive_bin";
+
+	if( hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin cell.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_cell->hive_bin != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hive bin cell - hive bin value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bin_grab_reference(
+	     hive_bin,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reference to hive bin.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bin_cell->hive_bin = hive_bin;
+
 	return( 1 );
 }
 
+/* Frees the hive bin cell data
+ * This releases the reference to the hive bin that contains the hive bin cell if any
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bin_cell_free_data(
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bin_cell_free_data";
+
+	if( hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin cell.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_cell->hive_bin != NULL )
+	{
+		hive_bin_cell->data = NULL;
+
+		if( libregf_hive_bin_free(
+		     &( hive_bin_cell->hive_bin ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release reference to hive bin.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
@@ -43,6 +43,11 @@ struct libregf_hive_bin_cell
 	 */
 	const uint8_t *data;
 
+	/* The reference to the hive bin that contains the cell, which is used
+	 * when the hive bin can be evicted from the cache
+	 */
+	struct libregf_hive_bin *hive_bin;
+
 	/* The hive bin cell size
 	 */
 	uint32_t size;
@@ -60,6 +65,15 @@ int libregf_hive_bin_cell_free(
      libregf_hive_bin_cell_t **hive_bin_cell,
      libcerror_error_t **error );
 
+int libregf_hive_bin_cell_reference_hive_bin(
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     struct libregf_hive_bin *hive_bin,
+     libcerror_error_t **error );
+
+int libregf_hive_bin_cell_free_data(
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
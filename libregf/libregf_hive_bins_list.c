@@ -30,12 +30,33 @@
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
 #include "libregf_libbfio.h"
+#include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
+#include "libregf_security_key.h"
 #include "libregf_unused.h"
 
+#include "regf_hive_bin.h"
+
+#if defined( LIBREGF_HIVE_BINS_LIST_HAVE_ATOMIC_HIVE_BINS )
+#define libregf_hive_bins_list_hive_bins_load( hive_bins ) \
+	__atomic_load_n( &( hive_bins ), __ATOMIC_ACQUIRE )
+
+#define libregf_hive_bins_list_hive_bins_store( hive_bins, value ) \
+	__atomic_store_n( &( hive_bins ), value, __ATOMIC_RELEASE )
+
+#else
+#define libregf_hive_bins_list_hive_bins_load( hive_bins ) \
+	hive_bins
+
+#define libregf_hive_bins_list_hive_bins_store( hive_bins, value ) \
+	hive_bins = value
+
+#endif /* defined( LIBREGF_HIVE_BINS_LIST_HAVE_ATOMIC_HIVE_BINS ) */
+
 /* Creates a hive bins list
  * Make sure the value hive_bins_list is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -115,12 +136,12 @@ int libregf_hive_bins_list_initialize(
 	}
 	if( libfdata_list_initialize(
 	     &( ( *hive_bins_list )->data_list ),
-	     NULL,
+	     (intptr_t *) *hive_bins_list,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libregf_hive_bins_list_read_element_data,
 	     NULL,
-	     0,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -132,9 +153,11 @@ int libregf_hive_bins_list_initialize(
 
 		goto on_error;
 	}
+	/* The data cache is resized when the number of hive bins is known
+	 */
 	if( libfcache_cache_initialize(
 	     &( ( *hive_bins_list )->data_cache ),
-	     LIBREGF_MAXIMUM_CACHE_ENTRIES_HIVE_BINS,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -146,6 +169,35 @@ int libregf_hive_bins_list_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_btree_initialize(
+	     &( ( *hive_bins_list )->security_keys_tree ),
+	     LIBREGF_SECURITY_KEYS_TREE_MAXIMUM_NUMBER_OF_SUB_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security keys tree.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *hive_bins_list )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *hive_bins_list )->io_handle = io_handle;
 
 	return( 1 );
@@ -153,6 +205,19 @@ int libregf_hive_bins_list_initialize(
 on_error:
 	if( *hive_bins_list != NULL )
 	{
+		if( ( *hive_bins_list )->security_keys_tree != NULL )
+		{
+			libcdata_btree_free(
+			 &( ( *hive_bins_list )->security_keys_tree ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *hive_bins_list )->data_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *hive_bins_list )->data_cache ),
+			 NULL );
+		}
 		if( ( *hive_bins_list )->data_list != NULL )
 		{
 			libfdata_list_free(
@@ -175,6 +240,7 @@ int libregf_hive_bins_list_free(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_hive_bins_list_free";
+	int hive_bin_index    = 0;
 	int result            = 1;
 
 	if( hive_bins_list == NULL )
@@ -190,6 +256,21 @@ int libregf_hive_bins_list_free(
 	}
 	if( *hive_bins_list != NULL )
 	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *hive_bins_list )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		/* The io_handle reference is freed elsewhere
 		 */
 		if( ( *hive_bins_list )->data_list != NULL )
@@ -224,6 +305,54 @@ int libregf_hive_bins_list_free(
 				result = -1;
 			}
 		}
+		if( ( *hive_bins_list )->page_hive_bin_indexes != NULL )
+		{
+			memory_free(
+			 ( *hive_bins_list )->page_hive_bin_indexes );
+		}
+		if( ( *hive_bins_list )->hive_bins != NULL )
+		{
+			for( hive_bin_index = 0;
+			     hive_bin_index < ( *hive_bins_list )->number_of_hive_bins;
+			     hive_bin_index++ )
+			{
+				if( libregf_hive_bin_free(
+				     &( ( *hive_bins_list )->hive_bins[ hive_bin_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free hive bin: %d.",
+					 function,
+					 hive_bin_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *hive_bins_list )->hive_bins );
+		}
+		if( ( *hive_bins_list )->hive_bin_offsets != NULL )
+		{
+			memory_free(
+			 ( *hive_bins_list )->hive_bin_offsets );
+		}
+		if( libcdata_btree_free(
+		     &( ( *hive_bins_list )->security_keys_tree ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libregf_security_key_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free security keys tree.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *hive_bins_list );
 
@@ -268,6 +397,133 @@ int libregf_hive_bins_list_empty_cache(
 	return( 1 );
 }
 
+/* Resizes the cache of a hive bins list
+ * The cache is sized to the number of hive bins up to the maximum number of cached hive bins
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_resize_cache(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libregf_hive_bins_list_resize_cache";
+	int maximum_number_of_cached_hive_bins = 0;
+	int number_of_elements                 = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     hive_bins_list->data_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from data list.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_cached_hive_bins = hive_bins_list->io_handle->maximum_number_of_cached_hive_bins;
+
+	if( number_of_elements < maximum_number_of_cached_hive_bins )
+	{
+		maximum_number_of_cached_hive_bins = number_of_elements;
+	}
+	if( maximum_number_of_cached_hive_bins <= 0 )
+	{
+		maximum_number_of_cached_hive_bins = 1;
+	}
+	if( libfcache_cache_resize(
+	     hive_bins_list->data_cache,
+	     maximum_number_of_cached_hive_bins,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the file data
+ * The hive bins reference the file data instead of reading and copying it
+ * The file data must remain available for the lifetime of the hive bins list
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_set_file_data(
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint8_t *file_data,
+     size_t file_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_set_file_data";
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bins_list->file_data      = file_data;
+	hive_bins_list->file_data_size = file_data_size;
+
+	return( 1 );
+}
+
 /* Reads the hive bins
  * Returns 1 if successful, 0 if no hive bin signature was found or -1 on error
  */
@@ -281,7 +537,11 @@ int libregf_hive_bins_list_read_file_io_handle(
 	libregf_hive_bin_header_t *hive_bin_header = NULL;
 	static char *function                      = "libregf_hive_bins_list_read_file_io_handle";
 	off64_t alignment_size                     = 0;
+	uint32_t maximum_number_of_pages           = 0;
+	uint32_t number_of_pages                   = 0;
+	uint32_t page_index                        = 0;
 	int hive_bin_index                         = 0;
+	int number_of_elements                     = 0;
 	int result                                 = 0;
 
 	if( hive_bins_list == NULL )
@@ -306,6 +566,62 @@ int libregf_hive_bins_list_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfdata_list_get_number_of_elements(
+	     hive_bins_list->data_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from data list.",
+		 function );
+
+		goto on_error;
+	}
+	if( hive_bins_list->page_hive_bin_indexes != NULL )
+	{
+		memory_free(
+		 hive_bins_list->page_hive_bin_indexes );
+
+		hive_bins_list->page_hive_bin_indexes = NULL;
+		hive_bins_list->number_of_pages       = 0;
+	}
+	/* Hive bins are page aligned hence the hive bin of an offset
+	 * can be looked up in a table with an entry per page
+	 */
+	maximum_number_of_pages = hive_bins_size / LIBREGF_HIVE_BIN_PAGE_SIZE;
+
+	if( ( number_of_elements == 0 )
+	 && ( maximum_number_of_pages > 0 ) )
+	{
+		if( (size_t) maximum_number_of_pages > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of pages value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		hive_bins_list->page_hive_bin_indexes = (int *) memory_allocate(
+		                                                 sizeof( int ) * maximum_number_of_pages );
+
+		if( hive_bins_list->page_hive_bin_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page hive bin indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libregf_hive_bin_header_initialize(
 	     &hive_bin_header,
 	     error ) != 1 )
@@ -341,6 +657,36 @@ int libregf_hive_bins_list_read_file_io_handle(
 
 			goto on_error;
 		}
+		if( libregf_io_handle_increment_counter(
+		     hive_bins_list->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ,
+		     (uint64_t) sizeof( regf_hive_bin_header_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment number of bytes read.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_io_handle_increment_counter(
+		     hive_bins_list->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_READ_CALLS,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment number of read calls.",
+			 function );
+
+			goto on_error;
+		}
 		if( ( result == 0 )
 		 || ( hive_bin_header->size == 0 ) )
 		{
@@ -407,6 +753,30 @@ int libregf_hive_bins_list_read_file_io_handle(
 
 			goto on_error;
 		}
+		if( hive_bins_list->page_hive_bin_indexes != NULL )
+		{
+			number_of_pages = hive_bin_header->size / LIBREGF_HIVE_BIN_PAGE_SIZE;
+
+			if( ( ( hive_bin_header->size % LIBREGF_HIVE_BIN_PAGE_SIZE ) != 0 )
+			 || ( number_of_pages > ( maximum_number_of_pages - page_index ) ) )
+			{
+				/* The hive bins are not page aligned, fall back to searching the data list
+				 */
+				memory_free(
+				 hive_bins_list->page_hive_bin_indexes );
+
+				hive_bins_list->page_hive_bin_indexes = NULL;
+			}
+			else
+			{
+				while( number_of_pages > 0 )
+				{
+					hive_bins_list->page_hive_bin_indexes[ page_index++ ] = hive_bin_index;
+
+					number_of_pages--;
+				}
+			}
+		}
 		file_offset    += hive_bin_header->size;
 		hive_bins_size -= hive_bin_header->size;
 
@@ -446,10 +816,49 @@ int libregf_hive_bins_list_read_file_io_handle(
 	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) != 0 )
 	{
 		hive_bins_list->io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED;
+
+		/* The hive bins of a corrupted hive are looked up by searching the data list
+		 */
+		if( hive_bins_list->page_hive_bin_indexes != NULL )
+		{
+			memory_free(
+			 hive_bins_list->page_hive_bin_indexes );
+
+			hive_bins_list->page_hive_bin_indexes = NULL;
+		}
+
+		/* Cell offsets in corrupted hive bins cannot be trusted,
+		 * hence only cells determined by reading the entire hive bin are used
+		 */
+		hive_bins_list->flags |= LIBREGF_HIVE_BINS_FLAG_READ_ALL_CELLS;
+	}
+	if( hive_bins_list->page_hive_bin_indexes != NULL )
+	{
+		hive_bins_list->number_of_pages = page_index;
+	}
+	if( libregf_hive_bins_list_resize_cache(
+	     hive_bins_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize cache.",
+		 function );
+
+		goto on_error;
 	}
 	return( 1 );
 
 on_error:
+	if( hive_bins_list->page_hive_bin_indexes != NULL )
+	{
+		memory_free(
+		 hive_bins_list->page_hive_bin_indexes );
+
+		hive_bins_list->page_hive_bin_indexes = NULL;
+	}
 	if( hive_bin_header != NULL )
 	{
 		libregf_hive_bin_header_free(
@@ -483,6 +892,28 @@ int libregf_hive_bins_list_get_index_at_offset(
 
 		return( -1 );
 	}
+	if( hive_bins_list->page_hive_bin_indexes != NULL )
+	{
+		if( hive_bin_index == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid hive bin index.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( offset < 0 )
+		 || ( ( offset / LIBREGF_HIVE_BIN_PAGE_SIZE ) >= (off64_t) hive_bins_list->number_of_pages ) )
+		{
+			return( 0 );
+		}
+		*hive_bin_index = hive_bins_list->page_hive_bin_indexes[ offset / LIBREGF_HIVE_BIN_PAGE_SIZE ];
+
+		return( 1 );
+	}
 	result = libfdata_list_get_element_index_at_offset(
 	          hive_bins_list->data_list,
 	          offset,
@@ -506,20 +937,27 @@ int libregf_hive_bins_list_get_index_at_offset(
 	return( result );
 }
 
-/* Retrives a hive bin cell at a specific offset
+/* Freezes a hive bins list
+ * Reads all hive bins and their cells so that hive bin cells can be retrieved
+ * without modifying the hive bins list, the data cache is no longer used
  * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bins_list_get_cell_at_offset(
+int libregf_hive_bins_list_freeze(
      libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
-     uint32_t hive_bin_cell_offset,
-     libregf_hive_bin_cell_t **hive_bin_cell,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_t *hive_bin = NULL;
-	static char *function        = "libregf_hive_bins_list_get_cell_at_offset";
-	off64_t hive_bin_data_offset = 0;
-	int hive_bin_index           = 0;
+	libregf_hive_bin_t **hive_bins = NULL;
+	off64_t *hive_bin_offsets      = NULL;
+	static char *function          = "libregf_hive_bins_list_freeze";
+	size64_t element_size          = 0;
+	off64_t element_offset         = 0;
+	off64_t hive_bin_offset        = 0;
+	uint32_t element_flags         = 0;
+	int element_file_index         = 0;
+	int hive_bin_index             = 0;
+	int is_frozen                  = 0;
+	int number_of_hive_bins        = 0;
 
 	if( hive_bins_list == NULL )
 	{
@@ -532,98 +970,1592 @@ int libregf_hive_bins_list_get_cell_at_offset(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_at_offset(
-	     hive_bins_list->data_list,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) hive_bins_list->data_cache,
-	     (off64_t) hive_bin_cell_offset,
-	     &hive_bin_index,
-	     &hive_bin_data_offset,
-	     (intptr_t **) &hive_bin,
-	     0,
-	     error ) != 1 )
+	is_frozen = libregf_hive_bins_list_is_frozen(
+	             hive_bins_list,
+	             error );
+
+	if( is_frozen == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to determine if hive bins list is frozen.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_frozen != 0 )
+	{
+		return( 1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     hive_bins_list->data_list,
+	     &number_of_hive_bins,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from data list.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_hive_bins == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_hive_bins < 0 )
+	 || ( (size_t) number_of_hive_bins > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hive bins value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	hive_bins = (libregf_hive_bin_t **) memory_allocate(
+	                                     sizeof( libregf_hive_bin_t * ) * number_of_hive_bins );
+
+	if( hive_bins == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hive bins.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hive_bins,
+	     0,
+	     sizeof( libregf_hive_bin_t * ) * number_of_hive_bins ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hive bins.",
+		 function );
+
+		memory_free(
+		 hive_bins );
+
+		hive_bins = NULL;
+
+		goto on_error;
+	}
+	hive_bin_offsets = (off64_t *) memory_allocate(
+	                                sizeof( off64_t ) * number_of_hive_bins );
+
+	if( hive_bin_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hive bin offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data list offsets are the sum of the sizes of the preceding hive bins
+	 */
+	for( hive_bin_index = 0;
+	     hive_bin_index < number_of_hive_bins;
+	     hive_bin_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     hive_bins_list->data_list,
+		     hive_bin_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data list element: %d.",
+			 function,
+			 hive_bin_index );
+
+			goto on_error;
+		}
+		if( libregf_hive_bins_list_read_hive_bin(
+		     hive_bins_list,
+		     file_io_handle,
+		     element_offset,
+		     element_size,
+		     1,
+		     &( hive_bins[ hive_bin_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin: %d.",
+			 function,
+			 hive_bin_index );
+
+			goto on_error;
+		}
+		hive_bin_offsets[ hive_bin_index ] = hive_bin_offset;
+
+		hive_bin_offset += (off64_t) element_size;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have frozen the hive bins list in the meantime
+	 */
+	if( libregf_hive_bins_list_hive_bins_load( hive_bins_list->hive_bins ) == NULL )
+	{
+		hive_bins_list->hive_bin_offsets    = hive_bin_offsets;
+		hive_bins_list->number_of_hive_bins = number_of_hive_bins;
+
+		/* The hive bins are published last, once published the hive bins, their offsets
+		 * and the number of hive bins are not modified until the hive bins list is freed
+		 */
+		libregf_hive_bins_list_hive_bins_store(
+		 hive_bins_list->hive_bins,
+		 hive_bins );
+
+		hive_bins        = NULL;
+		hive_bin_offsets = NULL;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( hive_bin_offsets != NULL )
+	{
+		memory_free(
+		 hive_bin_offsets );
+
+		hive_bin_offsets = NULL;
+	}
+	if( hive_bins != NULL )
+	{
+		for( hive_bin_index = 0;
+		     hive_bin_index < number_of_hive_bins;
+		     hive_bin_index++ )
+		{
+			if( libregf_hive_bin_free(
+			     &( hive_bins[ hive_bin_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin: %d.",
+				 function,
+				 hive_bin_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 hive_bins );
+	}
+	return( 1 );
+
+on_error:
+	if( hive_bin_offsets != NULL )
+	{
+		memory_free(
+		 hive_bin_offsets );
+	}
+	if( hive_bins != NULL )
+	{
+		for( hive_bin_index = 0;
+		     hive_bin_index < number_of_hive_bins;
+		     hive_bin_index++ )
+		{
+			if( hive_bins[ hive_bin_index ] != NULL )
+			{
+				libregf_hive_bin_free(
+				 &( hive_bins[ hive_bin_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 hive_bins );
+	}
+	return( -1 );
+}
+
+/* Determines if a hive bins list is frozen
+ * The hive bins are published once by libregf_hive_bins_list_freeze, hence they are read
+ * with an atomic operation if available, otherwise while holding the read lock
+ * Returns 1 if frozen, 0 if not or -1 on error
+ */
+int libregf_hive_bins_list_is_frozen(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_is_frozen";
+	int is_frozen         = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BINS_LIST_HAVE_ATOMIC_HIVE_BINS )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libregf_hive_bins_list_hive_bins_load( hive_bins_list->hive_bins ) != NULL )
+	{
+		is_frozen = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_HIVE_BINS_LIST_HAVE_ATOMIC_HIVE_BINS )
+	if( libcthreads_read_write_lock_release_for_read(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( is_frozen );
+}
+
+/* Retrieves the security key at a specific offset
+ * A security key is read once and shared by the keys that reference it
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_get_security_key_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     uint32_t security_key_offset,
+     libregf_security_key_t **security_key,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t hive_bin_cell;
+	libregf_security_key_t lookup_security_key;
+	libcdata_tree_node_t *upper_node              = NULL;
+	libregf_security_key_t *existing_security_key = NULL;
+	libregf_security_key_t *new_security_key      = NULL;
+	static char *function                         = "libregf_hive_bins_list_get_security_key_at_offset";
+	int result                                    = 0;
+	int value_index                               = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &lookup_security_key,
+	     0,
+	     sizeof( libregf_security_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup security key.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_security_key.offset = security_key_offset;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_btree_get_value_by_value(
+	          hive_bins_list->security_keys_tree,
+	          (intptr_t *) &lookup_security_key,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libregf_security_key_compare_by_offset,
+	          &upper_node,
+	          (intptr_t **) &existing_security_key,
+	          error );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security key: 0x%08" PRIx32 " from tree.",
+		 function,
+		 security_key_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*security_key = existing_security_key;
+
+		return( 1 );
+	}
+	/* The security key is read without holding the lock since retrieving
+	 * the hive bin cell grabs the lock itself
+	 */
+	if( libregf_hive_bins_list_get_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     security_key_offset,
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		goto on_error;
+	}
+	if( libregf_security_key_initialize(
+	     &new_security_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_security_key_read_data(
+	     new_security_key,
+	     hive_bins_list->io_handle,
+	     hive_bin_cell.data,
+	     hive_bin_cell.size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
+	new_security_key->offset = security_key_offset;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have read the same security key in the meantime
+	 * in which case the security key in the tree is used
+	 */
+	result = libcdata_btree_insert_value(
+	          hive_bins_list->security_keys_tree,
+	          &value_index,
+	          (intptr_t *) new_security_key,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libregf_security_key_compare_by_offset,
+	          &upper_node,
+	          (intptr_t **) &existing_security_key,
+	          error );
+
+	if( result == 1 )
+	{
+		existing_security_key = new_security_key;
+		new_security_key      = NULL;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert security key: 0x%08" PRIx32 " into tree.",
+		 function,
+		 security_key_offset );
+
+		goto on_error;
+	}
+	if( new_security_key != NULL )
+	{
+		if( libregf_security_key_free(
+		     &new_security_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free security key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*security_key = existing_security_key;
+
+	return( 1 );
+
+on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
+	if( new_security_key != NULL )
+	{
+		libregf_security_key_free(
+		 &new_security_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrives a hive bin cell at a specific offset from a frozen hive bins list
+ * The hive bins of a frozen hive bins list are not modified, hence no lock is needed
+ * once libregf_hive_bins_list_is_frozen has returned 1
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_get_frozen_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t hive_bin_cell_offset,
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_get_frozen_cell_at_offset";
+	int hive_bin_index    = -1;
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->hive_bins == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing hive bins.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->page_hive_bin_indexes != NULL )
+	{
+		if( ( hive_bin_cell_offset / LIBREGF_HIVE_BIN_PAGE_SIZE ) < hive_bins_list->number_of_pages )
+		{
+			hive_bin_index = hive_bins_list->page_hive_bin_indexes[ hive_bin_cell_offset / LIBREGF_HIVE_BIN_PAGE_SIZE ];
+		}
+	}
+	else
+	{
+		/* Find the last hive bin that starts at or before the offset
+		 */
+		upper_index = hive_bins_list->number_of_hive_bins;
+
+		while( lower_index < upper_index )
+		{
+			middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+			if( hive_bins_list->hive_bin_offsets[ middle_index ] <= (off64_t) hive_bin_cell_offset )
+			{
+				lower_index = middle_index + 1;
+			}
+			else
+			{
+				upper_index = middle_index;
+			}
+		}
+		hive_bin_index = lower_index - 1;
+	}
+	if( ( hive_bin_index < 0 )
+	 || ( hive_bin_index >= hive_bins_list->number_of_hive_bins ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hive bin cell offset: %" PRIu32 " (0x%08" PRIx32 ") value out of bounds.",
+		 function,
+		 hive_bin_cell_offset,
+		 hive_bin_cell_offset );
+
+		return( -1 );
+	}
+	if( libregf_hive_bin_get_cell_at_offset(
+	     hive_bins_list->hive_bins[ hive_bin_index ],
+	     hive_bin_cell_offset,
+	     hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 hive_bin_cell_offset,
+		 hive_bin_cell_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrives a hive bin cell at a specific offset
+ * The cell references a hive bin that is managed by the cache,
+ * use libregf_hive_bin_cell_free_data to release the reference once the cell data is no longer needed
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_get_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     uint32_t hive_bin_cell_offset,
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_t *hive_bin = NULL;
+	static char *function        = "libregf_hive_bins_list_get_cell_at_offset";
+	off64_t hive_bin_data_offset = 0;
+	int hive_bin_index           = 0;
+	int is_frozen                = 0;
+	int result                   = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin cell.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bin_cell->hive_bin = NULL;
+
+	is_frozen = libregf_hive_bins_list_is_frozen(
+	             hive_bins_list,
+	             error );
+
+	if( is_frozen == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if hive bins list is frozen.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_frozen != 0 )
+	{
+		result = libregf_hive_bins_list_get_frozen_cell_at_offset(
+		          hive_bins_list,
+		          hive_bin_cell_offset,
+		          hive_bin_cell,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frozen hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 hive_bin_cell_offset,
+			 hive_bin_cell_offset );
+
+			result = -1;
+		}
+	}
+	else
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     hive_bins_list->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* A hive bin that is not cached is read from the file IO handle while the lock is held
+		 */
+		if( hive_bins_list->page_hive_bin_indexes != NULL )
+		{
+			/* The page table maps the offset to the hive bin without searching the data list
+			 */
+			if( ( hive_bin_cell_offset / LIBREGF_HIVE_BIN_PAGE_SIZE ) >= hive_bins_list->number_of_pages )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid hive bin cell offset: %" PRIu32 " (0x%08" PRIx32 ") value out of bounds.",
+				 function,
+				 hive_bin_cell_offset,
+				 hive_bin_cell_offset );
+
+				result = -1;
+			}
+			else
+			{
+				hive_bin_index = hive_bins_list->page_hive_bin_indexes[ hive_bin_cell_offset / LIBREGF_HIVE_BIN_PAGE_SIZE ];
+
+				result = libfdata_list_get_element_value_by_index(
+				          hive_bins_list->data_list,
+				          (intptr_t *) file_io_handle,
+				          (libfdata_cache_t *) hive_bins_list->data_cache,
+				          hive_bin_index,
+				          (intptr_t **) &hive_bin,
+				          0,
+				          error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 hive_bin_cell_offset,
+					 hive_bin_cell_offset );
+
+					result = -1;
+				}
+			}
+		}
+		else
+		{
+			result = libfdata_list_get_element_value_at_offset(
+			          hive_bins_list->data_list,
+			          (intptr_t *) file_io_handle,
+			          (libfdata_cache_t *) hive_bins_list->data_cache,
+			          (off64_t) hive_bin_cell_offset,
+			          &hive_bin_index,
+			          &hive_bin_data_offset,
+			          (intptr_t **) &hive_bin,
+			          0,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 hive_bin_cell_offset,
+				 hive_bin_cell_offset );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			/* Determining the cells of the hive bin modifies the hive bin
+			 */
+			if( libregf_hive_bin_get_cell_at_offset(
+			     hive_bin,
+			     hive_bin_cell_offset,
+			     hive_bin_cell,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 hive_bin_cell_offset,
+				 hive_bin_cell_offset );
+
+				result = -1;
+			}
+			/* The hive bin can be evicted from the cache by another thread
+			 * once the lock is released, hence the cell references the hive bin
+			 * unless it references file data that is not managed by the cache
+			 */
+			else if( hive_bin->data_is_referenced == 0 )
+			{
+				if( libregf_hive_bin_cell_reference_hive_bin(
+				     hive_bin_cell,
+				     hive_bin,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to reference hive bin of cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 hive_bin_cell_offset,
+					 hive_bin_cell_offset );
+
+					result = -1;
+				}
+			}
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     hive_bins_list->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			libregf_hive_bin_cell_free_data(
+			 hive_bin_cell,
+			 NULL );
+
+			return( -1 );
+		}
+#endif
+	}
+	/* The lookups are counted the same way for frozen and non-frozen hive bins
+	 */
+	if( hive_bins_list->io_handle != NULL )
+	{
+		if( libregf_io_handle_increment_counter(
+		     hive_bins_list->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_HIVE_BINS_CACHE_LOOKUPS,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment hive bins cache lookups.",
+			 function );
+
+			libregf_hive_bin_cell_free_data(
+			 hive_bin_cell,
+			 NULL );
+
+			return( -1 );
+		}
+		if( result == 1 )
+		{
+			if( libregf_io_handle_increment_counter(
+			     hive_bins_list->io_handle,
+			     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_CELLS_RESOLVED,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to increment number of cells resolved.",
+				 function );
+
+				libregf_hive_bin_cell_free_data(
+				 hive_bin_cell,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of hive bins
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_get_number_of_hive_bins(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int *number_of_hive_bins,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_get_number_of_hive_bins";
+	int is_frozen         = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hive_bins == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hive bins.",
+		 function );
+
+		return( -1 );
+	}
+	is_frozen = libregf_hive_bins_list_is_frozen(
+	             hive_bins_list,
+	             error );
+
+	if( is_frozen == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if hive bins list is frozen.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_frozen != 0 )
+	{
+		*number_of_hive_bins = hive_bins_list->number_of_hive_bins;
+
+		return( 1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     hive_bins_list->data_list,
+	     number_of_hive_bins,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from data list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific hive bin cell of a specific hive bin
+ * The cells are ordered by their offset, which allows to iterate the cells in file order
+ * The cell references a hive bin that is managed by the cache,
+ * use libregf_hive_bin_cell_free_data to release the reference once the cell data is no longer needed
+ * Returns 1 if successful, 0 if the cell index is beyond the number of cells of the hive bin or -1 on error
+ */
+int libregf_hive_bins_list_get_cell_by_index(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     int hive_bin_index,
+     int cell_index,
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_t *hive_bin = NULL;
+	static char *function        = "libregf_hive_bins_list_get_cell_by_index";
+	int is_frozen                = 0;
+	int result                   = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( cell_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cell index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin cell.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bin_cell->hive_bin = NULL;
+
+	is_frozen = libregf_hive_bins_list_is_frozen(
+	             hive_bins_list,
+	             error );
+
+	if( is_frozen == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if hive bins list is frozen.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_frozen != 0 )
+	{
+		if( ( hive_bin_index < 0 )
+		 || ( hive_bin_index >= hive_bins_list->number_of_hive_bins ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hive bin index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The cells of a frozen hive bin have all been read
+		 */
+		hive_bin = hive_bins_list->hive_bins[ hive_bin_index ];
+
+		if( cell_index >= hive_bin->number_of_cells )
+		{
+			return( 0 );
+		}
+		if( libregf_hive_bin_get_cell_at_offset(
+		     hive_bin,
+		     hive_bin->cell_offsets[ cell_index ],
+		     hive_bin_cell,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hive bin: %d cell: %d.",
+			 function,
+			 hive_bin_index,
+			 cell_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfdata_list_get_element_value_by_index(
+	          hive_bins_list->data_list,
+	          (intptr_t *) file_io_handle,
+	          (libfdata_cache_t *) hive_bins_list->data_cache,
+	          hive_bin_index,
+	          (intptr_t **) &hive_bin,
+	          0,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin: %d.",
+		 function,
+		 hive_bin_index );
+
+		result = -1;
+	}
+	/* Determining the cells of the hive bin modifies the hive bin
+	 */
+	else if( hive_bin->cells_read == 0 )
+	{
+		if( libregf_hive_bin_read_cells_data(
+		     hive_bin,
+		     hive_bin->data,
+		     hive_bin->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin: %d cells.",
+			 function,
+			 hive_bin_index );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( cell_index >= hive_bin->number_of_cells )
+		{
+			result = 0;
+		}
+		else if( libregf_hive_bin_get_cell_at_offset(
+		          hive_bin,
+		          hive_bin->cell_offsets[ cell_index ],
+		          hive_bin_cell,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hive bin: %d cell: %d.",
+			 function,
+			 hive_bin_index,
+			 cell_index );
+
+			result = -1;
+		}
+		/* The hive bin can be evicted from the cache by another thread
+		 * once the lock is released, hence the cell references the hive bin
+		 */
+		else if( hive_bin->data_is_referenced == 0 )
+		{
+			if( libregf_hive_bin_cell_reference_hive_bin(
+			     hive_bin_cell,
+			     hive_bin,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reference hive bin: %d of cell: %d.",
+				 function,
+				 hive_bin_index,
+				 cell_index );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     hive_bins_list->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libregf_hive_bin_cell_free_data(
+		 hive_bin_cell,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends a hive bin to the list
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_append_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     off64_t offset,
+     uint32_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_append_bin";
+	int element_index     = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_append_element(
+	     hive_bins_list->data_list,
+	     &element_index,
+	     0,
+	     offset,
+	     (size64_t) size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append hive bin to data list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a hive bin
+ * The hive bin header is read at the file offset and must match the size
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_read_hive_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     uint8_t read_all_cells,
+     libregf_hive_bin_t **hive_bin,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_header_t *hive_bin_header = NULL;
+	static char *function                      = "libregf_hive_bins_list_read_hive_bin";
+	int result                                 = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hive_bin != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hive bin value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bin_header_initialize(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bin header.",
+		 function );
+
+		goto on_error;
+	}
+	if( hive_bins_list->file_data != NULL )
+	{
+		if( ( file_offset < 0 )
+		 || ( (size64_t) file_offset >= (size64_t) hive_bins_list->file_data_size )
+		 || ( size > (size64_t) ( hive_bins_list->file_data_size - (size_t) file_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data range value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		result = libregf_hive_bin_header_read_data(
+		          hive_bin_header,
+		          &( hive_bins_list->file_data[ file_offset ] ),
+		          (size_t) size,
+		          error );
+	}
+	else
+	{
+		result = libregf_hive_bin_header_read_file_io_handle(
+		          hive_bin_header,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bin header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 hive_bin_cell_offset,
-		 hive_bin_cell_offset );
+		 file_offset,
+		 file_offset );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libregf_hive_bin_get_cell_at_offset(
-	     hive_bin,
-	     hive_bin_cell_offset,
-	     hive_bin_cell,
-	     error ) != 1 )
+	if( (size64_t) hive_bin_header->size != size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in hive bin size (stored: %" PRIu32 " != calculated: %" PRIu64 ").",
 		 function,
-		 hive_bin_cell_offset,
-		 hive_bin_cell_offset );
+		 hive_bin_header->size,
+		 size );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
+	if( libregf_hive_bin_initialize(
+	     hive_bin,
+	     hive_bin_header->offset,
+	     hive_bin_header->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bin.",
+		 function );
 
-/* Appends a hive bin to the list
- * Returns 1 if successful or -1 on error
- */
-int libregf_hive_bins_list_append_bin(
-     libregf_hive_bins_list_t *hive_bins_list,
-     off64_t offset,
-     uint32_t size,
-     libcerror_error_t **error )
-{
-	static char *function = "libregf_hive_bins_list_append_bin";
-	int element_index     = 0;
+		goto on_error;
+	}
+	/* By default the cells are read on demand
+	 */
+	if( hive_bins_list->file_data != NULL )
+	{
+		/* The hive bin references the file data instead of copying it
+		 */
+		result = libregf_hive_bin_set_data(
+		          *hive_bin,
+		          &( hive_bins_list->file_data[ file_offset + sizeof( regf_hive_bin_header_t ) ] ),
+		          (size_t) size - sizeof( regf_hive_bin_header_t ),
+		          error );
 
-	if( hive_bins_list == NULL )
+		if( ( result == 1 )
+		 && ( read_all_cells != 0 ) )
+		{
+			result = libregf_hive_bin_read_cells_data(
+			          *hive_bin,
+			          ( *hive_bin )->data,
+			          ( *hive_bin )->data_size,
+			          error );
+		}
+	}
+	else if( read_all_cells != 0 )
+	{
+		result = libregf_hive_bin_read_cells_file_io_handle(
+		          *hive_bin,
+		          file_io_handle,
+		          file_offset + sizeof( regf_hive_bin_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libregf_hive_bin_read_data_file_io_handle(
+		          *hive_bin,
+		          file_io_handle,
+		          file_offset + sizeof( regf_hive_bin_header_t ),
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bin cells.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfdata_list_append_element(
-	     hive_bins_list->data_list,
-	     &element_index,
-	     0,
-	     offset,
-	     (size64_t) size,
-	     0,
+	if( hive_bins_list->file_data == NULL )
+	{
+		/* The hive bin header and data are read separately
+		 */
+		if( libregf_io_handle_increment_counter(
+		     hive_bins_list->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ,
+		     (uint64_t) size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment number of bytes read.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_io_handle_increment_counter(
+		     hive_bins_list->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_READ_CALLS,
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment number of read calls.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libregf_hive_bin_header_free(
+	     &hive_bin_header,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append hive bin to data list.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin header.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	if( *hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 hive_bin,
+		 NULL );
+	}
+	if( hive_bin_header != NULL )
+	{
+		libregf_hive_bin_header_free(
+		 &hive_bin_header,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads a hive bin
  * Callback function for the data list
+ * The callback is called while the write lock of the hive bins list is held,
+ * hence hive bins that are not cached are read one at a time
  * Returns 1 if successful or -1 on error
  */
 int libregf_hive_bins_list_read_element_data(
-     intptr_t *data_handle LIBREGF_ATTRIBUTE_UNUSED,
+     libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfdata_cache_t *cache,
@@ -634,87 +2566,128 @@ int libregf_hive_bins_list_read_element_data(
      uint8_t read_flags LIBREGF_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_t *hive_bin               = NULL;
-	libregf_hive_bin_header_t *hive_bin_header = NULL;
-	static char *function                      = "libregf_hive_bins_list_read_element_data";
+	libregf_hive_bin_t *hive_bin = NULL;
+	static char *function        = "libregf_hive_bins_list_read_element_data";
+	int number_of_cache_entries  = 0;
+	int number_of_cache_values   = 0;
+	uint8_t read_all_cells       = 0;
 
-	LIBREGF_UNREFERENCED_PARAMETER( data_handle )
 	LIBREGF_UNREFERENCED_PARAMETER( data_range_file_index )
 	LIBREGF_UNREFERENCED_PARAMETER( data_range_flags )
 	LIBREGF_UNREFERENCED_PARAMETER( read_flags )
 
-	if( libregf_hive_bin_header_initialize(
-	     &hive_bin_header,
-	     error ) != 1 )
+	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create hive bin header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
 		 function );
 
-		goto on_error;
-	}
-	if( libregf_hive_bin_header_read_file_io_handle(
-	     hive_bin_header,
-	     file_io_handle,
-	     data_range_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read hive bin header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 data_range_offset,
-		 data_range_offset );
-
-		goto on_error;
+		return( -1 );
 	}
-	if( (size64_t) hive_bin_header->size != data_range_size )
+	if( hive_bins_list->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: mismatch in hive bin size (stored: %" PRIu32 " != calculated: %" PRIu64 ").",
-		 function,
-		 hive_bin_header->size,
-		 data_range_size );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libregf_hive_bin_initialize(
-	     &hive_bin,
-	     hive_bin_header->offset,
-	     hive_bin_header->size,
+	if( libregf_io_handle_increment_counter(
+	     hive_bins_list->io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_HIVE_BINS_CACHE_MISSES,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create hive bin.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment hive bins cache misses.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libregf_hive_bin_read_cells_file_io_handle(
-	     hive_bin,
+	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_READ_ALL_CELLS ) != 0 )
+	{
+		read_all_cells = 1;
+	}
+	if( libregf_hive_bins_list_read_hive_bin(
+	     hive_bins_list,
 	     file_io_handle,
+	     data_range_offset,
+	     data_range_size,
+	     read_all_cells,
+	     &hive_bin,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read hive bin cells.",
-		 function );
+		 "%s: unable to read hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_range_offset,
+		 data_range_offset );
 
 		goto on_error;
 	}
+	if( cache != NULL )
+	{
+		/* Storing the hive bin in a full cache evicts another hive bin
+		 */
+		if( libfcache_cache_get_number_of_entries(
+		     (libfcache_cache_t *) cache,
+		     &number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_get_number_of_cache_values(
+		     (libfcache_cache_t *) cache,
+		     &number_of_cache_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache values.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_cache_values >= number_of_cache_entries )
+		{
+			if( libregf_io_handle_increment_counter(
+			     hive_bins_list->io_handle,
+			     LIBREGF_IO_HANDLE_COUNTER_HIVE_BINS_CACHE_EVICTIONS,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to increment hive bins cache evictions.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	if( libfdata_list_element_set_element_value(
 	     element,
 	     (intptr_t *) file_io_handle,
@@ -733,19 +2706,6 @@ int libregf_hive_bins_list_read_element_data(
 
 		goto on_error;
 	}
-	if( libregf_hive_bin_header_free(
-	     &hive_bin_header,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free hive bin header.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -755,12 +2715,6 @@ on_error:
 		 &hive_bin,
 		 NULL );
 	}
-	if( hive_bin_header != NULL )
-	{
-		libregf_hive_bin_header_free(
-		 &hive_bin_header,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -25,17 +25,28 @@
 #include <common.h>
 #include <types.h>
 
+#include "libregf_hive_bin.h"
 #include "libregf_hive_bin_cell.h"
 #include "libregf_io_handle.h"
 #include "libregf_libbfio.h"
+#include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
+#include "libregf_security_key.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The hive bins of a frozen hive bins list are published with atomic operations when
+ * the compiler provides them, otherwise while holding the read/write lock
+ */
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ ) && defined( __ATOMIC_ACQUIRE )
+#define LIBREGF_HIVE_BINS_LIST_HAVE_ATOMIC_HIVE_BINS
+#endif
+
 typedef struct libregf_hive_bins_list libregf_hive_bins_list_t;
 
 struct libregf_hive_bins_list
@@ -52,9 +63,48 @@ struct libregf_hive_bins_list
 	 */
 	libfcache_cache_t *data_cache;
 
+	/* The file data, which is set when the file is accessed in memory
+	 */
+	const uint8_t *file_data;
+
+	/* The file data size
+	 */
+	size_t file_data_size;
+
+	/* The hive bin index of every page, used to map an offset to a hive bin
+	 */
+	int *page_hive_bin_indexes;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The hive bins, which are set when the hive bins list is frozen
+	 */
+	libregf_hive_bin_t **hive_bins;
+
+	/* The (data list) offsets of the hive bins
+	 */
+	off64_t *hive_bin_offsets;
+
+	/* The number of hive bins
+	 */
+	int number_of_hive_bins;
+
+	/* The security keys tree, which contains the security keys that have been read
+	 * by their offset, they are shared by the keys that reference them
+	 */
+	libcdata_btree_t *security_keys_tree;
+
 	/* Various flags
 	 */
 	uint8_t flags;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock, which serializes access to the data cache
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libregf_hive_bins_list_initialize(
@@ -70,6 +120,16 @@ int libregf_hive_bins_list_empty_cache(
      libregf_hive_bins_list_t *hive_bins_list,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_resize_cache(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_set_file_data(
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint8_t *file_data,
+     size_t file_data_size,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_read_file_io_handle(
      libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
@@ -83,11 +143,46 @@ int libregf_hive_bins_list_get_index_at_offset(
      int *hive_bin_index,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_freeze(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_is_frozen(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_get_security_key_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     uint32_t security_key_offset,
+     libregf_security_key_t **security_key,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_get_frozen_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t hive_bin_cell_offset,
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_get_cell_at_offset(
      libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
      uint32_t hive_bin_cell_offset,
-     libregf_hive_bin_cell_t **hive_bin_cell,
+     libregf_hive_bin_cell_t *hive_bin_cell,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_get_number_of_hive_bins(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int *number_of_hive_bins,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_get_cell_by_index(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     int hive_bin_index,
+     int cell_index,
+     libregf_hive_bin_cell_t *hive_bin_cell,
      libcerror_error_t **error );
 
 int libregf_hive_bins_list_append_bin(
@@ -96,8 +191,17 @@ int libregf_hive_bins_list_append_bin(
      uint32_t size,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_read_hive_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     uint8_t read_all_cells,
+     libregf_hive_bin_t **hive_bin,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_read_element_data(
-     intptr_t *data_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfdata_cache_t *cache,
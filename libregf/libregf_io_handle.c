@@ -24,14 +24,38 @@
 #include <types.h>
 
 #include "libregf_codepage.h"
+#include "libregf_definitions.h"
 #include "libregf_io_handle.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 #include "libregf_unused.h"
 
 #include "regf_file_header.h"
 
 const char *regf_file_signature = "regf";
 
+#if defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+#define libregf_io_handle_counter_add( counter, value ) \
+	__atomic_fetch_add( &( counter ), value, __ATOMIC_RELAXED )
+
+#define libregf_io_handle_counter_load( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#define libregf_io_handle_counter_store( counter, value ) \
+	__atomic_store_n( &( counter ), value, __ATOMIC_RELAXED )
+
+#else
+#define libregf_io_handle_counter_add( counter, value ) \
+	counter += value
+
+#define libregf_io_handle_counter_load( counter ) \
+	counter
+
+#define libregf_io_handle_counter_store( counter, value ) \
+	counter = value
+
+#endif /* defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS ) */
+
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -92,7 +116,25 @@ int libregf_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *io_handle )->ascii_codepage = LIBREGF_CODEPAGE_WINDOWS_1252;
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *io_handle )->ascii_codepage                     = LIBREGF_CODEPAGE_WINDOWS_1252;
+	( *io_handle )->maximum_number_of_cached_hive_bins = LIBREGF_MAXIMUM_CACHE_ENTRIES_HIVE_BINS;
+	( *io_handle )->maximum_number_of_cached_values    = LIBREGF_MAXIMUM_CACHE_ENTRIES_VALUES;
+	( *io_handle )->maximum_number_of_cached_keys      = LIBREGF_MAXIMUM_CACHE_ENTRIES_KEYS;
 
 	return( 1 );
 
@@ -115,6 +157,7 @@ int libregf_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -129,12 +172,27 @@ int libregf_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *io_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears an IO handle
@@ -144,7 +202,14 @@ int libregf_io_handle_clear(
      libregf_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_io_handle_clear";
+	static char *function                  = "libregf_io_handle_clear";
+	int maximum_number_of_cached_hive_bins = 0;
+	int maximum_number_of_cached_values    = 0;
+	int maximum_number_of_cached_keys      = 0;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_t *mutex             = NULL;
+#endif
 
 	if( io_handle == NULL )
 	{
@@ -157,6 +222,15 @@ int libregf_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The cache sizes are configured by the user and retained
+	 */
+	maximum_number_of_cached_hive_bins = io_handle->maximum_number_of_cached_hive_bins;
+	maximum_number_of_cached_values    = io_handle->maximum_number_of_cached_values;
+	maximum_number_of_cached_keys      = io_handle->maximum_number_of_cached_keys;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	mutex = io_handle->mutex;
+#endif
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -171,8 +245,534 @@ int libregf_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBREGF_CODEPAGE_WINDOWS_1252;
+	io_handle->ascii_codepage                     = LIBREGF_CODEPAGE_WINDOWS_1252;
+	io_handle->maximum_number_of_cached_hive_bins = maximum_number_of_cached_hive_bins;
+	io_handle->maximum_number_of_cached_values    = maximum_number_of_cached_values;
+	io_handle->maximum_number_of_cached_keys      = maximum_number_of_cached_keys;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	io_handle->mutex = mutex;
+#endif
 	return( 1 );
 }
 
+/* Resets the statistics of an IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_io_handle_reset_statistics(
+     libregf_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_io_handle_reset_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+	if( libcthreads_mutex_grab(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libregf_io_handle_counter_store(
+	 io_handle->hive_bins_cache_lookups,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->hive_bins_cache_misses,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->hive_bins_cache_evictions,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->values_cache_lookups,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->values_cache_misses,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->keys_cache_lookups,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->keys_cache_misses,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->number_of_cells_resolved,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->number_of_bytes_read,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->number_of_read_calls,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->number_of_keys_materialized,
+	 0 );
+
+	libregf_io_handle_counter_store(
+	 io_handle->number_of_values_materialized,
+	 0 );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+	if( libcthreads_mutex_release(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Increments a specific counter of an IO handle
+ * The counters are shared by all the threads that read the file and are updated
+ * with atomic operations if available, otherwise while holding the mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_io_handle_increment_counter(
+     libregf_io_handle_t *io_handle,
+     int counter,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	static char *function   = "libregf_io_handle_increment_counter";
+	uint64_t *counter_value = NULL;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( counter )
+	{
+		case LIBREGF_IO_HANDLE_COUNTER_HIVE_BINS_CACHE_LOOKUPS:
+			counter_value = &( io_handle->hive_bins_cache_lookups );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_HIVE_BINS_CACHE_MISSES:
+			counter_value = &( io_handle->hive_bins_cache_misses );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_HIVE_BINS_CACHE_EVICTIONS:
+			counter_value = &( io_handle->hive_bins_cache_evictions );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_LOOKUPS:
+			counter_value = &( io_handle->values_cache_lookups );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_MISSES:
+			counter_value = &( io_handle->values_cache_misses );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_KEYS_CACHE_LOOKUPS:
+			counter_value = &( io_handle->keys_cache_lookups );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_KEYS_CACHE_MISSES:
+			counter_value = &( io_handle->keys_cache_misses );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_CELLS_RESOLVED:
+			counter_value = &( io_handle->number_of_cells_resolved );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ:
+			counter_value = &( io_handle->number_of_bytes_read );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_READ_CALLS:
+			counter_value = &( io_handle->number_of_read_calls );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_KEYS_MATERIALIZED:
+			counter_value = &( io_handle->number_of_keys_materialized );
+			break;
+
+		case LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_VALUES_MATERIALIZED:
+			counter_value = &( io_handle->number_of_values_materialized );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported counter: %d.",
+			 function,
+			 counter );
+
+			return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+	if( libcthreads_mutex_grab(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libregf_io_handle_counter_add(
+	 *counter_value,
+	 value );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+	if( libcthreads_mutex_release(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific statistic of an IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_io_handle_get_statistic(
+     libregf_io_handle_t *io_handle,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_io_handle_get_statistic";
+	uint64_t lookups      = 0;
+	uint64_t misses       = 0;
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+	if( libcthreads_mutex_grab(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	switch( statistic_type )
+	{
+		case LIBREGF_STATISTIC_HIVE_BINS_CACHE_HITS:
+			/* The hits are the lookups that did not require a read
+			 */
+			lookups = libregf_io_handle_counter_load(
+			           io_handle->hive_bins_cache_lookups );
+
+			misses = libregf_io_handle_counter_load(
+			          io_handle->hive_bins_cache_misses );
+
+			if( lookups > misses )
+			{
+				*value = lookups - misses;
+			}
+			else
+			{
+				*value = 0;
+			}
+			break;
+
+		case LIBREGF_STATISTIC_HIVE_BINS_CACHE_MISSES:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->hive_bins_cache_misses );
+			break;
+
+		case LIBREGF_STATISTIC_HIVE_BINS_CACHE_EVICTIONS:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->hive_bins_cache_evictions );
+			break;
+
+		case LIBREGF_STATISTIC_VALUES_CACHE_HITS:
+			lookups = libregf_io_handle_counter_load(
+			           io_handle->values_cache_lookups );
+
+			misses = libregf_io_handle_counter_load(
+			          io_handle->values_cache_misses );
+
+			if( lookups > misses )
+			{
+				*value = lookups - misses;
+			}
+			else
+			{
+				*value = 0;
+			}
+			break;
+
+		case LIBREGF_STATISTIC_VALUES_CACHE_MISSES:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->values_cache_misses );
+			break;
+
+		case LIBREGF_STATISTIC_KEYS_CACHE_HITS:
+			lookups = libregf_io_handle_counter_load(
+			           io_handle->keys_cache_lookups );
+
+			misses = libregf_io_handle_counter_load(
+			          io_handle->keys_cache_misses );
+
+			if( lookups > misses )
+			{
+				*value = lookups - misses;
+			}
+			else
+			{
+				*value = 0;
+			}
+			break;
+
+		case LIBREGF_STATISTIC_KEYS_CACHE_MISSES:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->keys_cache_misses );
+			break;
+
+		case LIBREGF_STATISTIC_NUMBER_OF_CELLS_RESOLVED:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->number_of_cells_resolved );
+			break;
+
+		case LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->number_of_bytes_read );
+			break;
+
+		case LIBREGF_STATISTIC_NUMBER_OF_READ_CALLS:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->number_of_read_calls );
+			break;
+
+		case LIBREGF_STATISTIC_NUMBER_OF_KEYS_MATERIALIZED:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->number_of_keys_materialized );
+			break;
+
+		case LIBREGF_STATISTIC_NUMBER_OF_VALUES_MATERIALIZED:
+			*value = libregf_io_handle_counter_load(
+			          io_handle->number_of_values_materialized );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported statistic type: %d.",
+			 function,
+			 statistic_type );
+
+			result = -1;
+			break;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS )
+	if( libcthreads_mutex_release(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Marks the file as corrupted
+ * The flags are updated while holding the mutex since they can be updated
+ * by multiple threads that walk the file
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_io_handle_set_corrupted(
+     libregf_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_io_handle_set_corrupted";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines if the file is corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libregf_io_handle_is_corrupted(
+     libregf_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_io_handle_is_corrupted";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( io_handle->flags & LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
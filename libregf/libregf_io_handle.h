@@ -26,11 +26,19 @@
 #include <types.h>
 
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The statistics counters are updated with atomic operations when the compiler
+ * provides lock-free 64-bit atomic operations, otherwise while holding the mutex
+ */
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ ) && defined( __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 ) && defined( __ATOMIC_RELAXED )
+#define LIBREGF_IO_HANDLE_HAVE_ATOMIC_COUNTERS
+#endif
+
 extern const char *regf_file_signature;
 
 typedef struct libregf_io_handle libregf_io_handle_t;
@@ -60,6 +68,73 @@ struct libregf_io_handle
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The maximum number of cached hive bins
+	 */
+	int maximum_number_of_cached_hive_bins;
+
+	/* The maximum number of cached values per key
+	 */
+	int maximum_number_of_cached_values;
+
+	/* The maximum number of cached keys
+	 */
+	int maximum_number_of_cached_keys;
+
+	/* The number of hive bins cache lookups
+	 */
+	uint64_t hive_bins_cache_lookups;
+
+	/* The number of hive bins cache misses
+	 */
+	uint64_t hive_bins_cache_misses;
+
+	/* The number of hive bins cache evictions
+	 */
+	uint64_t hive_bins_cache_evictions;
+
+	/* The number of values cache lookups
+	 */
+	uint64_t values_cache_lookups;
+
+	/* The number of values cache misses
+	 */
+	uint64_t values_cache_misses;
+
+	/* The number of keys cache lookups
+	 */
+	uint64_t keys_cache_lookups;
+
+	/* The number of keys cache misses
+	 */
+	uint64_t keys_cache_misses;
+
+	/* The number of cells resolved
+	 */
+	uint64_t number_of_cells_resolved;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of read calls
+	 */
+	uint64_t number_of_read_calls;
+
+	/* The number of keys materialized
+	 */
+	uint64_t number_of_keys_materialized;
+
+	/* The number of values materialized
+	 */
+	uint64_t number_of_values_materialized;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The mutex, which serializes access to the flags and,
+	 * when atomic operations are not available, the statistics
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int libregf_io_handle_initialize(
@@ -74,6 +149,30 @@ int libregf_io_handle_clear(
      libregf_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libregf_io_handle_reset_statistics(
+     libregf_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libregf_io_handle_increment_counter(
+     libregf_io_handle_t *io_handle,
+     int counter,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int libregf_io_handle_get_statistic(
+     libregf_io_handle_t *io_handle,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libregf_io_handle_set_corrupted(
+     libregf_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libregf_io_handle_is_corrupted(
+     libregf_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -31,12 +31,14 @@
 #include "libregf_io_handle.h"
 #include "libregf_key.h"
 #include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
 #include "libregf_key_tree.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcthreads.h"
 #include "libregf_libfdata.h"
 #include "libregf_libuna.h"
+#include "libregf_name_hash_index.h"
 #include "libregf_value.h"
 #include "libregf_value_item.h"
 
@@ -50,6 +52,7 @@ int libregf_key_initialize(
      libbfio_handle_t *file_io_handle,
      uint32_t key_offset,
      libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
      libcerror_error_t **error )
 {
 	libregf_internal_key_t *internal_key = NULL;
@@ -119,37 +122,66 @@ int libregf_key_initialize(
 
 		return( -1 );
 	}
-	if( libregf_key_item_initialize(
-	     &( internal_key->key_item ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create key item.",
-		 function );
+	/* The key item is shared with the other keys of the same key offset
+	 * when a key item cache is provided
+	 */
+	if( key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_get_key_item(
+		     key_item_cache,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     (uint32_t) 0, /* TODO pass hash or key descriptor */
+		     &( internal_key->key_item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libregf_key_item_read(
-	     internal_key->key_item,
-	     file_io_handle,
-	     hive_bins_list,
-	     key_offset,
-	     (uint32_t) 0, /* TODO pass hash or key descriptor */
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read key item at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 key_offset,
-		 key_offset );
+		if( libregf_key_item_initialize(
+		     &( internal_key->key_item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     internal_key->key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     (uint32_t) 0, /* TODO pass hash or key descriptor */
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
@@ -170,7 +202,23 @@ int libregf_key_initialize(
 	internal_key->io_handle      = io_handle;
 	internal_key->key_offset     = key_offset;
 	internal_key->hive_bins_list = hive_bins_list;
+	internal_key->key_item_cache = key_item_cache;
 
+	if( libregf_io_handle_increment_counter(
+	     io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_KEYS_MATERIALIZED,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment number of keys materialized.",
+		 function );
+
+		goto on_error;
+	}
 	*key = (libregf_key_t *) internal_key;
 
 	return( 1 );
@@ -178,9 +226,17 @@ int libregf_key_initialize(
 on_error:
 	if( internal_key != NULL )
 	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( internal_key->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_key->read_write_lock ),
+			 NULL );
+		}
+#endif
 		if( internal_key->key_item != NULL )
 		{
-			libregf_key_item_free(
+			libregf_key_item_release_reference(
 			 &( internal_key->key_item ),
 			 NULL );
 		}
@@ -232,9 +288,10 @@ int libregf_key_free(
 			result = -1;
 		}
 #endif
-		/* The io_handle, file_io_handle and hive_bins_list references are freed elsewhere
+		/* The io_handle, file_io_handle, hive_bins_list and key_item_cache references are freed elsewhere
+		 * The key item is freed when no other key or the key item cache references it
 		 */
-		if( libregf_key_item_free(
+		if( libregf_key_item_release_reference(
 		     &( internal_key->key_item ),
 		     error ) != 1 )
 		{
@@ -242,7 +299,7 @@ int libregf_key_free(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free key item.",
+			 "%s: unable to release key item.",
 			 function );
 
 			result = -1;
@@ -253,6 +310,109 @@ int libregf_key_free(
 	return( result );
 }
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+
+/* Grabs the read/write lock of a key for reading
+ * The key is not modified once the hive bins list is frozen, hence the lock is not grabbed
+ * Returns 1 if the lock was grabbed, 0 if not or -1 on error
+ */
+int libregf_internal_key_grab_for_read(
+     libregf_internal_key_t *internal_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_internal_key_grab_for_read";
+	int is_frozen         = 0;
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	is_frozen = libregf_hive_bins_list_is_frozen(
+	             internal_key->hive_bins_list,
+	             error );
+
+	if( is_frozen == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if hive bins list is frozen.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_frozen != 0 )
+	{
+		return( 0 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases the read/write lock of a key for reading
+ * The lock is only released if it was grabbed by libregf_internal_key_grab_for_read
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_internal_key_release_for_read(
+     libregf_internal_key_t *internal_key,
+     int is_locked,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_internal_key_release_for_read";
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_locked == 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) */
+
 /* Determines if the key is corrupted
  * Returns 1 if corrupted, 0 if not or -1 on error
  */
@@ -264,6 +424,10 @@ int libregf_key_is_corrupted(
 	static char *function                = "libregf_key_is_corrupted";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -278,15 +442,17 @@ int libregf_key_is_corrupted(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -308,15 +474,16 @@ int libregf_key_is_corrupted(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -337,6 +504,10 @@ int libregf_key_get_offset(
 	static char *function                = "libregf_key_get_offset";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -373,15 +544,17 @@ int libregf_key_get_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -393,15 +566,16 @@ int libregf_key_get_offset(
 	*offset = (off64_t) internal_key->key_offset + internal_key->io_handle->hive_bins_list_offset + 4;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -422,6 +596,10 @@ int libregf_key_get_name_size(
 	static char *function                = "libregf_key_get_name_size";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -436,15 +614,17 @@ int libregf_key_get_name_size(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -465,15 +645,16 @@ int libregf_key_get_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -495,6 +676,10 @@ int libregf_key_get_name(
 	static char *function                = "libregf_key_get_name";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -509,15 +694,17 @@ int libregf_key_get_name(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -539,15 +726,16 @@ int libregf_key_get_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -570,6 +758,10 @@ int libregf_key_get_utf8_name_size(
 	static char *function                = "libregf_key_get_utf8_name_size";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -595,15 +787,17 @@ int libregf_key_get_utf8_name_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -625,15 +819,16 @@ int libregf_key_get_utf8_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -658,6 +853,10 @@ int libregf_key_get_utf8_name(
 	static char *function                = "libregf_key_get_utf8_name";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -683,15 +882,17 @@ int libregf_key_get_utf8_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -714,15 +915,16 @@ int libregf_key_get_utf8_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -745,6 +947,10 @@ int libregf_key_get_utf16_name_size(
 	static char *function                = "libregf_key_get_utf16_name_size";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -770,15 +976,17 @@ int libregf_key_get_utf16_name_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -800,15 +1008,16 @@ int libregf_key_get_utf16_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -833,6 +1042,10 @@ int libregf_key_get_utf16_name(
 	static char *function                = "libregf_value_get_utf16_name";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -858,15 +1071,17 @@ int libregf_key_get_utf16_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -889,15 +1104,16 @@ int libregf_key_get_utf16_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -918,6 +1134,10 @@ int libregf_key_get_class_name_size(
 	static char *function                = "libregf_key_get_class_name_size";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -932,15 +1152,17 @@ int libregf_key_get_class_name_size(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -963,15 +1185,16 @@ int libregf_key_get_class_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -993,6 +1216,10 @@ int libregf_key_get_class_name(
 	static char *function                = "libregf_key_get_class_name";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1007,15 +1234,17 @@ int libregf_key_get_class_name(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1039,15 +1268,16 @@ int libregf_key_get_class_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1070,6 +1300,10 @@ int libregf_key_get_utf8_class_name_size(
 	static char *function                = "libregf_key_get_utf8_class_name_size";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1095,15 +1329,17 @@ int libregf_key_get_utf8_class_name_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1127,15 +1363,16 @@ int libregf_key_get_utf8_class_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1160,6 +1397,10 @@ int libregf_key_get_utf8_class_name(
 	static char *function                = "libregf_key_get_utf8_class_name";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1185,15 +1426,17 @@ int libregf_key_get_utf8_class_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1218,15 +1461,16 @@ int libregf_key_get_utf8_class_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1249,6 +1493,10 @@ int libregf_key_get_utf16_class_name_size(
 	static char *function                = "libregf_key_get_utf16_class_name_size";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1274,15 +1522,17 @@ int libregf_key_get_utf16_class_name_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1306,15 +1556,16 @@ int libregf_key_get_utf16_class_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1339,6 +1590,10 @@ int libregf_key_get_utf16_class_name(
 	static char *function                = "libregf_value_get_utf16_class_name";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1364,15 +1619,17 @@ int libregf_key_get_utf16_class_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1397,15 +1654,16 @@ int libregf_key_get_utf16_class_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1426,6 +1684,10 @@ int libregf_key_get_last_written_time(
 	static char *function                = "libregf_key_get_last_written_time";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1440,15 +1702,17 @@ int libregf_key_get_last_written_time(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1469,15 +1733,16 @@ int libregf_key_get_last_written_time(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1498,6 +1763,10 @@ int libregf_key_get_security_descriptor_size(
 	static char *function                = "libregf_key_get_security_descriptor_size";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1512,15 +1781,17 @@ int libregf_key_get_security_descriptor_size(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1543,15 +1814,16 @@ int libregf_key_get_security_descriptor_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1573,6 +1845,10 @@ int libregf_key_get_security_descriptor(
 	static char *function                = "libregf_key_get_security_descriptor";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1587,15 +1863,17 @@ int libregf_key_get_security_descriptor(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1619,15 +1897,16 @@ int libregf_key_get_security_descriptor(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1648,6 +1927,10 @@ int libregf_key_get_number_of_values(
 	static char *function                = "libregf_key_get_number_of_values";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -1662,15 +1945,17 @@ int libregf_key_get_number_of_values(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1691,15 +1976,16 @@ int libregf_key_get_number_of_values(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1770,6 +2056,37 @@ int libregf_internal_key_get_value(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     internal_key->key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values list.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The values cache of the key item can be shared with other keys
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key->key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libfdata_list_get_list_element_by_index(
 	     internal_key->key_item->values_list,
 	     value_index,
@@ -1784,7 +2101,7 @@ int libregf_internal_key_get_value(
 		 function,
 		 value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libfdata_list_element_get_data_range(
 	     values_list_element,
@@ -1801,13 +2118,28 @@ int libregf_internal_key_get_value(
 		 "%s: unable to retrieve value data range.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	/* The offset is relative from the start of the hive bins list
 	 * and points to the start of the corresponding hive bin cell
 	 */
 	offset += internal_key->io_handle->hive_bins_list_offset + 4;
 
+	if( libregf_io_handle_increment_counter(
+	     internal_key->io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_LOOKUPS,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment values cache lookups.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_list_element_get_element_value(
 	     values_list_element,
 	     (intptr_t *) internal_key->file_io_handle,
@@ -1823,7 +2155,7 @@ int libregf_internal_key_get_value(
 		 "%s: unable to retrieve value item.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libregf_value_initialize(
 	     value,
@@ -1840,9 +2172,32 @@ int libregf_internal_key_get_value(
 		 "%s: unable to initialize value.",
 		 function );
 
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key->key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
+#endif
 	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_key->key_item->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Retrieves the value
@@ -2063,6 +2418,7 @@ int libregf_internal_key_get_value_by_utf8_name(
 	uint32_t flags                               = 0;
 	uint32_t name_hash                           = 0;
 	int file_index                               = 0;
+	int compare_result                           = 0;
 	int number_of_values                         = 0;
 	int result                                   = 0;
 	int value_index                              = 0;
@@ -2184,9 +2540,51 @@ int libregf_internal_key_get_value_by_utf8_name(
 		name_hash *= 37;
 		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
 	}
-	for( value_index = 0;
-	     value_index < number_of_values;
-	     value_index++ )
+	/* The value name hash index only contains the candidate values, the name of
+	 * a candidate still needs to be compared since name hashes can collide
+	 */
+	if( libregf_key_item_read_on_demand(
+	     internal_key->key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUE_NAME_INDEX,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key->key_item->value_name_hash_index == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The values cache of the key item can be shared with other keys
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key->key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_name_hash_index_get_first_entry_index(
+	          internal_key->key_item->value_name_hash_index,
+	          name_hash,
+	          &value_index,
+	          error );
+
+	while( result == 1 )
 	{
 		if( libfdata_list_get_list_element_by_index(
 		     internal_key->key_item->values_list,
@@ -2202,7 +2600,22 @@ int libregf_internal_key_get_value_by_utf8_name(
 			 function,
 			 value_index );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libregf_io_handle_increment_counter(
+		     internal_key->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_LOOKUPS,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment values cache lookups.",
+			 function );
+
+			goto on_error;
 		}
 		if( libfdata_list_element_get_element_value(
 		     values_list_element,
@@ -2220,17 +2633,17 @@ int libregf_internal_key_get_value_by_utf8_name(
 			 function,
 			 value_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libregf_value_item_compare_name_with_utf8_string(
-			  value_item,
-			  name_hash,
-			  utf8_string,
-			  utf8_string_length,
-			  internal_key->io_handle->ascii_codepage,
-			  error );
-
-		if( result == -1 )
+		compare_result = libregf_value_item_compare_name_with_utf8_string(
+		                  value_item,
+		                  name_hash,
+		                  utf8_string,
+		                  utf8_string_length,
+		                  internal_key->io_handle->ascii_codepage,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2239,57 +2652,95 @@ int libregf_internal_key_get_value_by_utf8_name(
 			 "%s: unable to compare value name with UTF-8 string.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result != 0 )
+		else if( compare_result != 0 )
 		{
 			break;
 		}
+		result = libregf_name_hash_index_get_next_entry_index(
+		          internal_key->key_item->value_name_hash_index,
+		          name_hash,
+		          &value_index,
+		          error );
 	}
-	if( value_index >= number_of_values )
-	{
-		return( 0 );
-	}
-	if( libfdata_list_element_get_data_range(
-	     values_list_element,
-	     &file_index,
-	     &offset,
-	     &size,
-	     &flags,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value data range.",
+		 "%s: unable to retrieve entry from value name hash index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	/* The offset is relative from the start of the hive bins list
-	 * and points to the start of the corresponding hive bin cell
-	 */
-	offset += internal_key->io_handle->hive_bins_list_offset + 4;
+	else if( result != 0 )
+	{
+		if( libfdata_list_element_get_data_range(
+		     values_list_element,
+		     &file_index,
+		     &offset,
+		     &size,
+		     &flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data range.",
+			 function );
 
-	if( libregf_value_initialize(
-	     value,
-	     internal_key->io_handle,
-	     internal_key->file_io_handle,
-	     offset,
-	     value_item,
+			goto on_error;
+		}
+		/* The offset is relative from the start of the hive bins list
+		 * and points to the start of the corresponding hive bin cell
+		 */
+		offset += internal_key->io_handle->hive_bins_list_offset + 4;
+
+		if( libregf_value_initialize(
+		     value,
+		     internal_key->io_handle,
+		     internal_key->file_io_handle,
+		     offset,
+		     value_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key->key_item->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize value.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_key->key_item->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Retrieves the value for the specific UTF-8 encoded name
@@ -2394,6 +2845,7 @@ int libregf_internal_key_get_value_by_utf16_name(
 	uint32_t flags                               = 0;
 	uint32_t name_hash                           = 0;
 	int file_index                               = 0;
+	int compare_result                           = 0;
 	int number_of_values                         = 0;
 	int result                                   = 0;
 	int value_index                              = 0;
@@ -2515,9 +2967,51 @@ int libregf_internal_key_get_value_by_utf16_name(
 		name_hash *= 37;
 		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
 	}
-	for( value_index = 0;
-	     value_index < number_of_values;
-	     value_index++ )
+	/* The value name hash index only contains the candidate values, the name of
+	 * a candidate still needs to be compared since name hashes can collide
+	 */
+	if( libregf_key_item_read_on_demand(
+	     internal_key->key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUE_NAME_INDEX,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key->key_item->value_name_hash_index == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The values cache of the key item can be shared with other keys
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key->key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_name_hash_index_get_first_entry_index(
+	          internal_key->key_item->value_name_hash_index,
+	          name_hash,
+	          &value_index,
+	          error );
+
+	while( result == 1 )
 	{
 		if( libfdata_list_get_list_element_by_index(
 		     internal_key->key_item->values_list,
@@ -2533,7 +3027,22 @@ int libregf_internal_key_get_value_by_utf16_name(
 			 function,
 			 value_index );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libregf_io_handle_increment_counter(
+		     internal_key->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_LOOKUPS,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment values cache lookups.",
+			 function );
+
+			goto on_error;
 		}
 		if( libfdata_list_element_get_element_value(
 		     values_list_element,
@@ -2551,17 +3060,17 @@ int libregf_internal_key_get_value_by_utf16_name(
 			 function,
 			 value_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libregf_value_item_compare_name_with_utf16_string(
-			  value_item,
-			  name_hash,
-			  utf16_string,
-			  utf16_string_length,
-			  internal_key->io_handle->ascii_codepage,
-			  error );
-
-		if( result == -1 )
+		compare_result = libregf_value_item_compare_name_with_utf16_string(
+		                  value_item,
+		                  name_hash,
+		                  utf16_string,
+		                  utf16_string_length,
+		                  internal_key->io_handle->ascii_codepage,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2570,57 +3079,95 @@ int libregf_internal_key_get_value_by_utf16_name(
 			 "%s: unable to compare value name with UTF-16 string.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result != 0 )
+		else if( compare_result != 0 )
 		{
 			break;
 		}
+		result = libregf_name_hash_index_get_next_entry_index(
+		          internal_key->key_item->value_name_hash_index,
+		          name_hash,
+		          &value_index,
+		          error );
 	}
-	if( value_index >= number_of_values )
-	{
-		return( 0 );
-	}
-	if( libfdata_list_element_get_data_range(
-	     values_list_element,
-	     &file_index,
-	     &offset,
-	     &size,
-	     &flags,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value data range.",
+		 "%s: unable to retrieve entry from value name hash index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	/* The offset is relative from the start of the hive bins list
-	 * and points to the start of the corresponding hive bin cell
-	 */
-	offset += internal_key->io_handle->hive_bins_list_offset + 4;
+	else if( result != 0 )
+	{
+		if( libfdata_list_element_get_data_range(
+		     values_list_element,
+		     &file_index,
+		     &offset,
+		     &size,
+		     &flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data range.",
+			 function );
 
-	if( libregf_value_initialize(
-	     value,
-	     internal_key->io_handle,
-	     internal_key->file_io_handle,
-	     offset,
-	     value_item,
+			goto on_error;
+		}
+		/* The offset is relative from the start of the hive bins list
+		 * and points to the start of the corresponding hive bin cell
+		 */
+		offset += internal_key->io_handle->hive_bins_list_offset + 4;
+
+		if( libregf_value_initialize(
+		     value,
+		     internal_key->io_handle,
+		     internal_key->file_io_handle,
+		     offset,
+		     value_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key->key_item->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize value.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_key->key_item->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Retrieves the value for the specific UTF-16 encoded name
@@ -2715,6 +3262,10 @@ int libregf_key_get_number_of_sub_keys(
 	static char *function                = "libregf_key_get_number_of_sub_keys";
 	int result                           = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -2729,15 +3280,17 @@ int libregf_key_get_number_of_sub_keys(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2758,15 +3311,16 @@ int libregf_key_get_number_of_sub_keys(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2790,6 +3344,10 @@ int libregf_key_get_sub_key(
 	static char *function                        = "libregf_key_get_sub_key";
 	int result                                   = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                                = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -2826,15 +3384,17 @@ int libregf_key_get_sub_key(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2874,6 +3434,7 @@ int libregf_key_get_sub_key(
 	          internal_key->file_io_handle,
 	          sub_key_descriptor->key_offset,
 	          internal_key->hive_bins_list,
+	          internal_key->key_item_cache,
 	          error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2887,15 +3448,16 @@ int libregf_key_get_sub_key(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2919,6 +3481,10 @@ int libregf_key_get_sub_key_by_index(
 	static char *function                        = "libregf_key_get_sub_key_by_index";
 	int result                                   = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                                = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -2955,15 +3521,17 @@ int libregf_key_get_sub_key_by_index(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3003,6 +3571,7 @@ int libregf_key_get_sub_key_by_index(
 	          internal_key->file_io_handle,
 	          sub_key_descriptor->key_offset,
 	          internal_key->hive_bins_list,
+	          internal_key->key_item_cache,
 	          error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3016,15 +3585,16 @@ int libregf_key_get_sub_key_by_index(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3167,6 +3737,7 @@ int libregf_internal_key_get_sub_key_by_utf8_name(
 		     internal_key->file_io_handle,
 		     sub_key_descriptor->key_offset,
 		     internal_key->hive_bins_list,
+		     internal_key->key_item_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3197,6 +3768,10 @@ int libregf_key_get_sub_key_by_utf8_name(
 	static char *function                = "libregf_key_get_sub_key_by_utf8_name";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -3211,15 +3786,17 @@ int libregf_key_get_sub_key_by_utf8_name(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3244,15 +3821,16 @@ int libregf_key_get_sub_key_by_utf8_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3277,6 +3855,10 @@ int libregf_key_get_sub_key_by_utf8_path(
 	static char *function                = "libregf_key_get_sub_key_by_utf8_path";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -3291,15 +3873,17 @@ int libregf_key_get_sub_key_by_utf8_path(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3309,6 +3893,8 @@ int libregf_key_get_sub_key_by_utf8_path(
 	          internal_key->io_handle,
 	          internal_key->file_io_handle,
 	          internal_key->hive_bins_list,
+	          internal_key->key_item_cache,
+	          NULL,
 	          internal_key->key_offset,
 	          utf8_string,
 	          utf8_string_length,
@@ -3327,15 +3913,16 @@ int libregf_key_get_sub_key_by_utf8_path(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3489,6 +4076,7 @@ int libregf_internal_key_get_sub_key_by_utf16_name(
 		     internal_key->file_io_handle,
 		     sub_key_descriptor->key_offset,
 		     internal_key->hive_bins_list,
+		     internal_key->key_item_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3519,6 +4107,10 @@ int libregf_key_get_sub_key_by_utf16_name(
 	static char *function                = "libregf_key_get_sub_key_by_utf16_name";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -3533,15 +4125,17 @@ int libregf_key_get_sub_key_by_utf16_name(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3566,15 +4160,16 @@ int libregf_key_get_sub_key_by_utf16_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3599,6 +4194,10 @@ int libregf_key_get_sub_key_by_utf16_path(
 	static char *function                = "libregf_key_get_sub_key_by_utf16_path";
 	int result                           = 0;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
 	if( key == NULL )
 	{
 		libcerror_error_set(
@@ -3613,15 +4212,17 @@ int libregf_key_get_sub_key_by_utf16_path(
 	internal_key = (libregf_internal_key_t *) key;
 
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
+	is_locked = libregf_internal_key_grab_for_read(
+	             internal_key,
+	             error );
+
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3631,6 +4232,8 @@ int libregf_key_get_sub_key_by_utf16_path(
 	          internal_key->io_handle,
 	          internal_key->file_io_handle,
 	          internal_key->hive_bins_list,
+	          internal_key->key_item_cache,
+	          NULL,
 	          internal_key->key_offset,
 	          utf16_string,
 	          utf16_string_length,
@@ -3649,15 +4252,16 @@ int libregf_key_get_sub_key_by_utf16_path(
 		result = -1;
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
+	if( libregf_internal_key_release_for_read(
+	     internal_key,
+	     is_locked,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
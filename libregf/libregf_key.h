@@ -29,6 +29,7 @@
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
 #include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcthreads.h"
@@ -58,7 +59,11 @@ struct libregf_internal_key
 	 */
 	libregf_hive_bins_list_t *hive_bins_list;
 
-	/* The key item
+	/* The key item cache
+	 */
+	libregf_key_item_cache_t *key_item_cache;
+
+	/* The key item, which can be shared with other keys
 	 */
 	libregf_key_item_t *key_item;
 
@@ -75,6 +80,7 @@ int libregf_key_initialize(
      libbfio_handle_t *file_io_handle,
      uint32_t key_offset,
      libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
      libcerror_error_t **error );
 
 LIBREGF_EXTERN \
@@ -82,6 +88,18 @@ int libregf_key_free(
      libregf_key_t **key,
      libcerror_error_t **error );
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+int libregf_internal_key_grab_for_read(
+     libregf_internal_key_t *internal_key,
+     libcerror_error_t **error );
+
+int libregf_internal_key_release_for_read(
+     libregf_internal_key_t *internal_key,
+     int is_locked,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) */
+
 LIBREGF_EXTERN \
 int libregf_key_is_corrupted(
      libregf_key_t *key,
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libregf_definitions.h"
 #include "libregf_key_descriptor.h"
 #include "libregf_libcerror.h"
 
@@ -129,3 +130,271 @@ int libregf_key_descriptor_free(
 	return( 1 );
 }
 
+
+/* Determines the sub key list hash values of an UTF-8 encoded name
+ * The name hash corresponds with the "lh" and the name hint with the "lf" hash value
+ * A hash value is 0 if it cannot be determined, which is the case for non-ASCII
+ * characters since the upper case mapping used by Windows can differ
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_descriptor_get_hash_values_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     uint32_t *name_hint,
+     libcerror_error_t **error )
+{
+	static char *function    = "libregf_key_descriptor_get_hash_values_from_utf8_string";
+	size_t utf8_string_index = 0;
+	uint32_t safe_name_hash  = 0;
+	uint32_t safe_name_hint  = 0;
+	uint8_t character        = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hint.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		character = utf8_string[ utf8_string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( character >= 0x80 )
+		{
+			if( utf8_string_index < 4 )
+			{
+				safe_name_hint = 0;
+			}
+			safe_name_hash = 0;
+
+			break;
+		}
+		if( ( character >= (uint8_t) 'a' )
+		 && ( character <= (uint8_t) 'z' ) )
+		{
+			character -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		if( utf8_string_index < 4 )
+		{
+			safe_name_hint |= (uint32_t) character << ( utf8_string_index * 8 );
+		}
+		safe_name_hash *= 37;
+		safe_name_hash += (uint32_t) character;
+	}
+	*name_hash = safe_name_hash;
+	*name_hint = safe_name_hint;
+
+	return( 1 );
+}
+
+/* Determines the sub key list hash values of an UTF-16 encoded name
+ * The name hash corresponds with the "lh" and the name hint with the "lf" hash value
+ * A hash value is 0 if it cannot be determined, which is the case for non-ASCII
+ * characters since the upper case mapping used by Windows can differ
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_descriptor_get_hash_values_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     uint32_t *name_hint,
+     libcerror_error_t **error )
+{
+	static char *function     = "libregf_key_descriptor_get_hash_values_from_utf16_string";
+	size_t utf16_string_index = 0;
+	uint32_t safe_name_hash   = 0;
+	uint32_t safe_name_hint   = 0;
+	uint16_t character        = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hint.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		character = utf16_string[ utf16_string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( character >= 0x80 )
+		{
+			if( utf16_string_index < 4 )
+			{
+				safe_name_hint = 0;
+			}
+			safe_name_hash = 0;
+
+			break;
+		}
+		if( ( character >= (uint16_t) 'a' )
+		 && ( character <= (uint16_t) 'z' ) )
+		{
+			character -= (uint16_t) 'a' - (uint16_t) 'A';
+		}
+		if( utf16_string_index < 4 )
+		{
+			safe_name_hint |= (uint32_t) character << ( utf16_string_index * 8 );
+		}
+		safe_name_hash *= 37;
+		safe_name_hash += (uint32_t) character;
+	}
+	*name_hash = safe_name_hash;
+	*name_hint = safe_name_hint;
+
+	return( 1 );
+}
+
+/* Compares the hash value of the key descriptor with the sub key list hash values of a name
+ * A name hash or name hint of 0 is not compared
+ * Returns 1 if the name can match, 0 if not or -1 on error
+ */
+int libregf_key_descriptor_compare_hash_value(
+     libregf_key_descriptor_t *key_descriptor,
+     uint32_t name_hash,
+     uint32_t name_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_descriptor_compare_hash_value";
+	uint8_t byte_index    = 0;
+	uint8_t character     = 0;
+
+	if( key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_descriptor->hash_value == 0 )
+	{
+		return( 1 );
+	}
+	if( key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+	{
+		if( ( name_hash != 0 )
+		 && ( name_hash != key_descriptor->hash_value ) )
+		{
+			return( 0 );
+		}
+	}
+	else if( ( key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HINT )
+	      && ( name_hint != 0 ) )
+	{
+		/* The name hint is compared case insensitive
+		 */
+		for( byte_index = 0;
+		     byte_index < 4;
+		     byte_index++ )
+		{
+			character = (uint8_t) ( key_descriptor->hash_value >> ( byte_index * 8 ) );
+
+			if( character >= 0x80 )
+			{
+				break;
+			}
+			if( ( character >= (uint8_t) 'a' )
+			 && ( character <= (uint8_t) 'z' ) )
+			{
+				character -= (uint8_t) 'a' - (uint8_t) 'A';
+			}
+			if( character != (uint8_t) ( name_hint >> ( byte_index * 8 ) ) )
+			{
+				return( 0 );
+			}
+		}
+	}
+	return( 1 );
+}
@@ -42,6 +42,10 @@ struct libregf_key_descriptor
 	/* The hash value
 	 */
 	uint32_t hash_value;
+
+	/* The hash type
+	 */
+	uint8_t hash_type;
 };
 
 int libregf_key_descriptor_initialize(
@@ -52,6 +56,26 @@ int libregf_key_descriptor_free(
      libregf_key_descriptor_t **key_descriptor,
      libcerror_error_t **error );
 
+int libregf_key_descriptor_get_hash_values_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     uint32_t *name_hint,
+     libcerror_error_t **error );
+
+int libregf_key_descriptor_get_hash_values_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     uint32_t *name_hint,
+     libcerror_error_t **error );
+
+int libregf_key_descriptor_compare_hash_value(
+     libregf_key_descriptor_t *key_descriptor,
+     uint32_t name_hash,
+     uint32_t name_hint,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
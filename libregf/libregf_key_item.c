@@ -33,9 +33,11 @@
 #include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
 #include "libregf_libuna.h"
+#include "libregf_name_hash_index.h"
 #include "libregf_named_key.h"
 #include "libregf_security_key.h"
 #include "libregf_sub_key_list.h"
@@ -44,6 +46,22 @@
 
 #include "regf_cell_values.h"
 
+#if defined( LIBREGF_KEY_ITEM_HAVE_ATOMIC_READ_FLAGS )
+#define libregf_key_item_read_flags_load( read_flags ) \
+	__atomic_load_n( &( read_flags ), __ATOMIC_ACQUIRE )
+
+#define libregf_key_item_read_flags_set( read_flags, value ) \
+	__atomic_fetch_or( &( read_flags ), value, __ATOMIC_RELEASE )
+
+#else
+#define libregf_key_item_read_flags_load( read_flags ) \
+	read_flags
+
+#define libregf_key_item_read_flags_set( read_flags, value ) \
+	read_flags |= value
+
+#endif /* defined( LIBREGF_KEY_ITEM_HAVE_ATOMIC_READ_FLAGS ) */
+
 /* Creates key item
  * Make sure the key_item is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -118,11 +136,35 @@ int libregf_key_item_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *key_item )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *key_item )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
 	if( *key_item != NULL )
 	{
+		if( ( *key_item )->sub_key_descriptors != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *key_item )->sub_key_descriptors ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *key_item );
 
@@ -154,6 +196,23 @@ int libregf_key_item_free(
 	}
 	if( *key_item != NULL )
 	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *key_item )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The file_io_handle, hive_bins_list and security_key references are freed elsewhere
+		 */
 		if( ( *key_item )->named_key != NULL )
 		{
 			if( libregf_named_key_free(
@@ -175,11 +234,6 @@ int libregf_key_item_free(
 			memory_free(
 			 ( *key_item )->class_name );
 		}
-		if( ( *key_item )->security_descriptor != NULL )
-		{
-			memory_free(
-			 ( *key_item )->security_descriptor );
-		}
 		if( ( *key_item )->values_list != NULL )
 		{
 			if( libfdata_list_free(
@@ -212,6 +266,38 @@ int libregf_key_item_free(
 				result = -1;
 			}
 		}
+		if( ( *key_item )->value_name_hash_index != NULL )
+		{
+			if( libregf_name_hash_index_free(
+			     &( ( *key_item )->value_name_hash_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value name hash index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_item )->sub_key_name_hash_index != NULL )
+		{
+			if( libregf_name_hash_index_free(
+			     &( ( *key_item )->sub_key_name_hash_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub key name hash index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_array_free(
 		     &( ( *key_item )->sub_key_descriptors ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
@@ -234,20 +320,15 @@ int libregf_key_item_free(
 	return( result );
 }
 
-/* Reads a key item
+/* Grabs a reference to a key item
+ * A key item can be shared by the key item cache and the keys
  * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_read(
+int libregf_key_item_grab_reference(
      libregf_key_item_t *key_item,
-     libbfio_handle_t *file_io_handle,
-     libregf_hive_bins_list_t *hive_bins_list,
-     off64_t key_offset,
-     uint32_t named_key_hash,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_read";
-	int hive_bin_index    = 0;
-	int result            = 0;
+	static char *function = "libregf_key_item_grab_reference";
 
 	if( key_item == NULL )
 	{
@@ -260,324 +341,188 @@ int libregf_key_item_read(
 
 		return( -1 );
 	}
-	if( key_item->named_key != NULL )
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_item->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key item - named key value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( libregf_named_key_initialize(
-	     &( key_item->named_key ),
+#endif
+	key_item->number_of_references += 1;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_item->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create named key.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libregf_key_item_read_named_key(
-	     key_item->named_key,
-	     file_io_handle,
-	     hive_bins_list,
-	     key_offset,
-	     named_key_hash,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read named key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 key_offset,
-		 key_offset );
+#endif
+	return( 1 );
+}
 
-		goto on_error;
-	}
-	if( libregf_key_item_read_class_name(
-	     key_item,
-	     file_io_handle,
-	     hive_bins_list,
-	     key_item->named_key->class_name_offset,
-	     key_item->named_key->class_name_size,
-	     error ) != 1 )
+/* Releases a reference to a key item
+ * The key item is freed when its last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_release_reference(
+     libregf_key_item_t **key_item,
+     libcerror_error_t **error )
+{
+	static char *function    = "libregf_key_item_release_reference";
+	int number_of_references = 0;
+
+	if( key_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read class name at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-		 function,
-		 key_item->named_key->class_name_offset,
-		 key_item->named_key->class_name_offset );
-
-		goto on_error;
-	}
-	if( key_item->named_key->security_key_offset != 0xffffffffUL )
-	{
-		if( libregf_key_item_read_security_key(
-		     key_item,
-		     file_io_handle,
-		     hive_bins_list,
-		     key_item->named_key->security_key_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 key_item->named_key->security_key_offset,
-			 key_item->named_key->security_key_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( key_item->named_key->number_of_sub_keys > 0 )
+	if( *key_item == NULL )
 	{
-		result = libregf_key_item_read_sub_keys_list(
-		          key_item->sub_key_descriptors,
-		          file_io_handle,
-		          hive_bins_list,
-		          (off64_t) key_item->named_key->sub_keys_list_offset,
-		          0,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sub keys list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 key_item->named_key->sub_keys_list_offset,
-			 key_item->named_key->sub_keys_list_offset );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
-		}
+		return( 1 );
 	}
-/* TODO clone function */
-	if( libfdata_list_initialize(
-	     &( key_item->values_list ),
-	     (intptr_t *) hive_bins_list,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libregf_value_item_read_element_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     ( *key_item )->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values data list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( key_item->values_cache ),
-	     LIBREGF_MAXIMUM_CACHE_ENTRIES_VALUES,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values cache.",
-		 function );
+#endif
+	( *key_item )->number_of_references -= 1;
 
-		goto on_error;
-	}
-	result = libregf_hive_bins_list_get_index_at_offset(
-	          hive_bins_list,
-	          (off64_t) key_item->named_key->values_list_offset,
-	          &hive_bin_index,
-	          error );
+	number_of_references = ( *key_item )->number_of_references;
 
-	if( result == -1 )
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     ( *key_item )->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if values list offset is valid.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
-	}
-	else if( result == 0 )
-	{
-		key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+		return( -1 );
 	}
-	else
+#endif
+	if( number_of_references <= 0 )
 	{
-		if( libregf_key_item_read_values_list(
+		if( libregf_key_item_free(
 		     key_item,
-		     file_io_handle,
-		     hive_bins_list,
-		     key_item->named_key->values_list_offset,
-		     key_item->named_key->number_of_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read values list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 key_item->named_key->values_list_offset,
-			 key_item->named_key->values_list_offset );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key item.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	/* The values and sub keys are read on demand
-	 */
-	return( 1 );
-
-on_error:
-	if( key_item->values_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( key_item->values_cache ),
-		 NULL );
-	}
-	if( key_item->values_list != NULL )
-	{
-		libfdata_list_free(
-		 &( key_item->values_list ),
-		 NULL );
-	}
-	if( key_item->security_descriptor != NULL )
-	{
-		memory_free(
-		 key_item->security_descriptor );
-
-		key_item->security_descriptor = NULL;
-	}
-	key_item->security_descriptor_size = 0;
-
-	if( key_item->class_name != NULL )
-	{
-		memory_free(
-		 key_item->class_name );
-
-		key_item->class_name = NULL;
-	}
-	key_item->class_name_size = 0;
-
-	if( key_item->named_key != NULL )
-	{
-		libregf_named_key_free(
-		 &( key_item->named_key ),
-		 NULL );
-	}
-	libcdata_array_empty(
-	 key_item->sub_key_descriptors,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
-	 NULL );
+	*key_item = NULL;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Reads a named key
- * Returns the number of bytes read if successful or -1 on error
+/* Reads a key item
+ * Only the named key is read, the class name, security key, sub keys and values
+ * are read on demand
+ * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_read_named_key(
-     libregf_named_key_t *named_key,
+int libregf_key_item_read(
+     libregf_key_item_t *key_item,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
-     off64_t named_key_offset,
+     off64_t key_offset,
      uint32_t named_key_hash,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
-	static char *function                  = "libregf_key_item_read_named_key";
+	static char *function = "libregf_key_item_read";
 
-	if( hive_bins_list == NULL )
+	if( key_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 "%s: invalid key item.",
 		 function );
 
 		return( -1 );
 	}
-	if( hive_bins_list->io_handle == NULL )
+	if( key_item->named_key != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bins list - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - named key value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( named_key_offset == 0 )
-	 || ( named_key_offset >= (off64_t) 0xffffffffUL ) )
+	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid named key offset.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading named key at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-		 function,
-		 named_key_offset,
-		 named_key_offset );
-	}
-#endif
-	if( libregf_hive_bins_list_get_cell_at_offset(
-	     hive_bins_list,
-	     file_io_handle,
-	     (uint32_t) named_key_offset,
-	     &hive_bin_cell,
-	     error ) != 1 )
+	if( libregf_named_key_initialize(
+	     &( key_item->named_key ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 named_key_offset,
-		 named_key_offset );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create named key.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libregf_named_key_read_data(
-	     named_key,
-	     hive_bins_list->io_handle,
-	     hive_bin_cell->data,
-	     hive_bin_cell->size,
+	if( libregf_key_item_read_named_key(
+	     key_item->named_key,
+	     file_io_handle,
+	     hive_bins_list,
+	     key_offset,
 	     named_key_hash,
 	     error ) != 1 )
 	{
@@ -587,25 +532,43 @@ int libregf_key_item_read_named_key(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read named key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 named_key_offset,
-		 named_key_offset );
+		 key_offset,
+		 key_offset );
 
-		return( -1 );
+		goto on_error;
 	}
+	key_item->file_io_handle = file_io_handle;
+	key_item->hive_bins_list = hive_bins_list;
+	key_item->read_flags     = 0;
+
 	return( 1 );
+
+on_error:
+	if( key_item->named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &( key_item->named_key ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads a class name
+/* Reads the parts of a key item that have not been read yet
+ * The read flags indicate which parts to read
  * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_read_class_name_data(
+int libregf_key_item_read_parts(
      libregf_key_item_t *key_item,
-     const uint8_t *data,
-     size_t data_size,
-     uint16_t class_name_size,
+     uint8_t read_flags,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_read_class_name_data";
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	static char *function                        = "libregf_key_item_read_parts";
+	int hive_bin_index                           = 0;
+	int maximum_number_of_cached_values          = 0;
+	int number_of_sub_key_descriptors            = 0;
+	int result                                   = 0;
+	int sub_key_descriptor_index                 = 0;
 
 	if( key_item == NULL )
 	{
@@ -618,159 +581,394 @@ int libregf_key_item_read_class_name_data(
 
 		return( -1 );
 	}
-	if( key_item->class_name != NULL )
+	if( key_item->named_key == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key item - class name value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - missing named key.",
 		 function );
 
 		return( -1 );
 	}
-	if( data == NULL )
+	if( key_item->hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - missing hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_size > (size_t) SSIZE_MAX )
+	if( key_item->hive_bins_list->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - invalid hive bins list - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The sub key name hash index requires the sub keys
+	 */
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEY_NAME_INDEX ) != 0 )
 	{
-		libcnotify_printf(
-		 "%s: data:\n",
-		 function );
-		libcnotify_print_data(
-		 data,
-		 data_size,
-		 0 );
+		read_flags |= LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS;
 	}
-#endif
-	if( ( class_name_size == 0 )
-	 || ( (size_t) class_name_size > data_size ) )
+	/* The value name hash index requires the values
+	 */
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUE_NAME_INDEX ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid class name size value out of bounds.",
-		 function );
-
-		goto on_error;
+		read_flags |= LIBREGF_KEY_ITEM_READ_FLAG_VALUES;
 	}
-	key_item->class_name = (uint8_t *) memory_allocate(
-	                                    sizeof( uint8_t ) * (size_t) class_name_size );
+	read_flags &= ~( key_item->read_flags );
 
-	if( key_item->class_name == NULL )
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create class name.",
-		 function );
+		if( libregf_key_item_read_class_name(
+		     key_item,
+		     key_item->file_io_handle,
+		     key_item->hive_bins_list,
+		     key_item->named_key->class_name_offset,
+		     key_item->named_key->class_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read class name at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_item->named_key->class_name_offset,
+			 key_item->named_key->class_name_offset );
 
-		goto on_error;
+			goto on_error;
+		}
+		libregf_key_item_read_flags_set(
+		 key_item->read_flags,
+		 LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME );
 	}
-	if( memory_copy(
-	     key_item->class_name,
-	     data,
-	     (size_t) class_name_size ) == NULL )
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_KEY ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to class name.",
-		 function );
+		if( key_item->named_key->security_key_offset != 0xffffffffUL )
+		{
+			if( libregf_key_item_read_security_key(
+			     key_item,
+			     key_item->file_io_handle,
+			     key_item->hive_bins_list,
+			     key_item->named_key->security_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_item->named_key->security_key_offset,
+				 key_item->named_key->security_key_offset );
 
-		goto on_error;
+				goto on_error;
+			}
+		}
+		libregf_key_item_read_flags_set(
+		 key_item->read_flags,
+		 LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_KEY );
 	}
-	key_item->class_name_size = class_name_size;
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS ) != 0 )
+	{
+		if( key_item->named_key->number_of_sub_keys > 0 )
+		{
+			result = libregf_key_item_read_sub_keys_list(
+			          key_item->sub_key_descriptors,
+			          key_item->file_io_handle,
+			          key_item->hive_bins_list,
+			          (off64_t) key_item->named_key->sub_keys_list_offset,
+			          0,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub keys list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_item->named_key->sub_keys_list_offset,
+				 key_item->named_key->sub_keys_list_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+			}
+		}
+		if( libcdata_array_get_number_of_entries(
+		     key_item->sub_key_descriptors,
+		     &number_of_sub_key_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from sub key descriptors array.",
+			 function );
+
+			goto on_error;
+		}
+		key_item->sub_keys_have_name_hashes = (uint8_t) ( number_of_sub_key_descriptors > 0 );
+
+		for( sub_key_descriptor_index = 0;
+		     sub_key_descriptor_index < number_of_sub_key_descriptors;
+		     sub_key_descriptor_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     key_item->sub_key_descriptors,
+			     sub_key_descriptor_index,
+			     (intptr_t **) &sub_key_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key descriptor: %d from array.",
+				 function,
+				 sub_key_descriptor_index );
+
+				goto on_error;
+			}
+			if( ( sub_key_descriptor == NULL )
+			 || ( sub_key_descriptor->hash_type != LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+			 || ( sub_key_descriptor->hash_value == 0 ) )
+			{
+				key_item->sub_keys_have_name_hashes = 0;
+
+				break;
+			}
+		}
+		libregf_key_item_read_flags_set(
+		 key_item->read_flags,
+		 LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS );
+	}
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEY_NAME_INDEX ) != 0 )
 	{
-		if( libregf_debug_print_utf16_string_value(
-		     function,
-		     "class name\t\t\t",
-		     key_item->class_name,
-		     (size_t) key_item->class_name_size,
-		     LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		if( libregf_key_item_read_sub_key_name_hash_index(
+		     key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub key name hash index.",
+			 function );
+
+			goto on_error;
+		}
+		libregf_key_item_read_flags_set(
+		 key_item->read_flags,
+		 LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEY_NAME_INDEX );
+	}
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUES ) != 0 )
+	{
+/* TODO clone function */
+		if( libfdata_list_initialize(
+		     &( key_item->values_list ),
+		     (intptr_t *) key_item->hive_bins_list,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libregf_value_item_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print UTF-16 string value.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create values data list.",
 			 function );
 
 			goto on_error;
 		}
-		if( (size_t) class_name_size < data_size )
+		/* The values cache is sized to the number of values of the key
+		 */
+		maximum_number_of_cached_values = key_item->hive_bins_list->io_handle->maximum_number_of_cached_values;
+
+		if( key_item->named_key->number_of_values < (uint32_t) maximum_number_of_cached_values )
 		{
-			libcnotify_printf(
-			 "%s: padding:\n",
+			maximum_number_of_cached_values = (int) key_item->named_key->number_of_values;
+		}
+		if( maximum_number_of_cached_values == 0 )
+		{
+			maximum_number_of_cached_values = 1;
+		}
+		if( libfcache_cache_initialize(
+		     &( key_item->values_cache ),
+		     maximum_number_of_cached_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create values cache.",
 			 function );
-			libcnotify_print_data(
-			 &( data[ (size_t) class_name_size ] ),
-			 data_size - (size_t) class_name_size,
-			 0 );
+
+			goto on_error;
+		}
+		result = libregf_hive_bins_list_get_index_at_offset(
+		          key_item->hive_bins_list,
+		          (off64_t) key_item->named_key->values_list_offset,
+		          &hive_bin_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if values list offset is valid.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
 		}
 		else
 		{
-			libcnotify_printf(
-			 "\n" );
+			if( libregf_key_item_read_values_list(
+			     key_item,
+			     key_item->file_io_handle,
+			     key_item->hive_bins_list,
+			     key_item->named_key->values_list_offset,
+			     key_item->named_key->number_of_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read values list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_item->named_key->values_list_offset,
+				 key_item->named_key->values_list_offset );
+
+				goto on_error;
+			}
 		}
+		libregf_key_item_read_flags_set(
+		 key_item->read_flags,
+		 LIBREGF_KEY_ITEM_READ_FLAG_VALUES );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUE_NAME_INDEX ) != 0 )
+	{
+		if( libregf_key_item_read_value_name_hash_index(
+		     key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value name hash index.",
+			 function );
 
+			goto on_error;
+		}
+		libregf_key_item_read_flags_set(
+		 key_item->read_flags,
+		 LIBREGF_KEY_ITEM_READ_FLAG_VALUE_NAME_INDEX );
+	}
 	return( 1 );
 
 on_error:
-	if( key_item->class_name != NULL )
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUE_NAME_INDEX ) == 0 )
 	{
-		memory_free(
-		 key_item->class_name );
-
-		key_item->class_name = NULL;
+		if( key_item->value_name_hash_index != NULL )
+		{
+			libregf_name_hash_index_free(
+			 &( key_item->value_name_hash_index ),
+			 NULL );
+		}
 	}
-	key_item->class_name_size = 0;
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUES ) == 0 )
+	{
+		if( key_item->values_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( key_item->values_cache ),
+			 NULL );
+		}
+		if( key_item->values_list != NULL )
+		{
+			libfdata_list_free(
+			 &( key_item->values_list ),
+			 NULL );
+		}
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEY_NAME_INDEX ) == 0 )
+	{
+		if( key_item->sub_key_name_hash_index != NULL )
+		{
+			libregf_name_hash_index_free(
+			 &( key_item->sub_key_name_hash_index ),
+			 NULL );
+		}
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS ) == 0 )
+	{
+		key_item->sub_keys_have_name_hashes = 0;
+
+		libcdata_array_empty(
+		 key_item->sub_key_descriptors,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
+		 NULL );
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_KEY ) == 0 )
+	{
+		key_item->security_key = NULL;
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME ) == 0 )
+	{
+		if( key_item->class_name != NULL )
+		{
+			memory_free(
+			 key_item->class_name );
 
+			key_item->class_name = NULL;
+		}
+		key_item->class_name_size = 0;
+	}
 	return( -1 );
 }
 
-/* Reads a class name
+/* Reads the parts of a key item on demand
+ * The read flags are checked with an atomic operation if available, otherwise while holding the read lock,
+ * the key item is only locked for writing while parts that have not been read yet are read,
+ * once read the parts are not modified
  * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_read_class_name(
+int libregf_key_item_read_on_demand(
      libregf_key_item_t *key_item,
-     libbfio_handle_t *file_io_handle,
-     libregf_hive_bins_list_t *hive_bins_list,
-     uint32_t class_name_offset,
-     uint16_t class_name_size,
+     uint8_t read_flags,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
-	static char *function                  = "libregf_key_item_read_class_name";
+	static char *function = "libregf_key_item_read_on_demand";
+	uint8_t parts_read    = 0;
+	int result            = 1;
 
 	if( key_item == NULL )
 	{
@@ -783,149 +981,158 @@ int libregf_key_item_read_class_name(
 
 		return( -1 );
 	}
-	if( key_item->class_name != NULL )
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_KEY_ITEM_HAVE_ATOMIC_READ_FLAGS )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_item->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key item - class name value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( hive_bins_list == NULL )
+#endif
+	if( ( libregf_key_item_read_flags_load( key_item->read_flags ) & read_flags ) == read_flags )
+	{
+		parts_read = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && !defined( LIBREGF_KEY_ITEM_HAVE_ATOMIC_READ_FLAGS )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_item->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( class_name_offset == 0xffffffffUL )
-	{
-		return( 1 );
-	}
-	if( ( class_name_offset == 0 )
-	 && ( class_name_size == 0 ) )
+#endif
+	if( parts_read != 0 )
 	{
 		return( 1 );
 	}
-	if( class_name_offset == 0 )
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_item->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid class name offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading class name at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-		 function,
-		 class_name_offset,
-		 class_name_offset );
-	}
 #endif
-	if( libregf_hive_bins_list_get_cell_at_offset(
-	     hive_bins_list,
-	     file_io_handle,
-	     class_name_offset,
-	     &hive_bin_cell,
-	     error ) != 1 )
+	/* The parts can have been read by another thread in the meantime
+	 */
+	if( ( key_item->read_flags & read_flags ) != read_flags )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-		 function,
-		 class_name_offset,
-		 class_name_offset );
+		if( libregf_key_item_read_parts(
+		     key_item,
+		     read_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item parts.",
+			 function );
 
-		return( -1 );
+			result = -1;
+		}
 	}
-	if( libregf_key_item_read_class_name_data(
-	     key_item,
-	     hive_bin_cell->data,
-	     hive_bin_cell->size,
-	     class_name_size,
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_item->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read class name at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-		 function,
-		 class_name_offset,
-		 class_name_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Reads a security key
- * Returns 1 if successful or -1 on error
+/* Reads a named key
+ * Returns the number of bytes read if successful or -1 on error
  */
-int libregf_key_item_read_security_key(
-     libregf_key_item_t *key_item,
+int libregf_key_item_read_named_key(
+     libregf_named_key_t *named_key,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
-     uint32_t security_key_offset,
+     off64_t named_key_offset,
+     uint32_t named_key_hash,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
-	libregf_security_key_t *security_key   = NULL;
-	static char *function                  = "libregf_key_item_read_security_key";
+	libregf_hive_bin_cell_t hive_bin_cell;
+	static char *function                  = "libregf_key_item_read_named_key";
 
-	if( key_item == NULL )
+	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
+		 "%s: invalid hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	if( key_item->security_descriptor != NULL )
+	if( hive_bins_list->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key item - security descriptor value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( security_key_offset == 0 )
-	 || ( security_key_offset == 0xffffffffUL ) )
+	if( ( named_key_offset == 0 )
+	 || ( named_key_offset >= (off64_t) 0xffffffffUL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid security key offset.",
+		 "%s: invalid named key offset.",
 		 function );
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading named key at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 function,
+		 named_key_offset,
+		 named_key_offset );
+	}
+#endif
 	if( libregf_hive_bins_list_get_cell_at_offset(
 	     hive_bins_list,
 	     file_io_handle,
-	     security_key_offset,
+	     (uint32_t) named_key_offset,
 	     &hive_bin_cell,
 	     error ) != 1 )
 	{
@@ -933,59 +1140,41 @@ int libregf_key_item_read_security_key(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 "%s: unable to retrieve hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 security_key_offset,
-		 security_key_offset );
-
-		goto on_error;
-	}
-	if( libregf_security_key_initialize(
-	     &security_key,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create security key.",
-		 function );
+		 named_key_offset,
+		 named_key_offset );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libregf_security_key_read_data(
-	     security_key,
+	if( libregf_named_key_read_data(
+	     named_key,
 	     hive_bins_list->io_handle,
-	     hive_bin_cell->data,
-	     hive_bin_cell->size,
+	     hive_bin_cell.data,
+	     hive_bin_cell.size,
+	     named_key_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 "%s: unable to read named key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 security_key_offset,
-		 security_key_offset );
+		 named_key_offset,
+		 named_key_offset );
 
 		goto on_error;
 	}
-	key_item->security_descriptor      = security_key->security_descriptor;
-	key_item->security_descriptor_size = security_key->security_descriptor_size;
-
-	security_key->security_descriptor      = NULL;
-	security_key->security_descriptor_size = 0;
-
-	if( libregf_security_key_free(
-	     &security_key,
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free security key.",
+		 "%s: unable to free hive bin cell data.",
 		 function );
 
 		goto on_error;
@@ -993,35 +1182,24 @@ int libregf_key_item_read_security_key(
 	return( 1 );
 
 on_error:
-	if( security_key != NULL )
-	{
-		libregf_security_key_free(
-		 &security_key,
-		 NULL );
-	}
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
 	return( -1 );
 }
 
-/* Reads a values list
+/* Reads a class name
  * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_read_values_list(
+int libregf_key_item_read_class_name_data(
      libregf_key_item_t *key_item,
-     libbfio_handle_t *file_io_handle,
-     libregf_hive_bins_list_t *hive_bins_list,
-     uint32_t values_list_offset,
-     uint32_t number_of_values_list_elements,
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t class_name_size,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
-	static char *function                  = "libregf_key_item_read_values_list";
-	size_t data_offset                     = 0;
-	size_t hive_bin_cell_size              = 0;
-	uint32_t values_list_element_index     = 0;
-	uint32_t values_list_element_offset    = 0;
-	int element_index                      = 0;
-	int hive_bin_index                     = 0;
-	int result                             = 0;
+	static char *function = "libregf_key_item_read_class_name_data";
 
 	if( key_item == NULL )
 	{
@@ -1034,64 +1212,39 @@ int libregf_key_item_read_values_list(
 
 		return( -1 );
 	}
-	if( hive_bins_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
-		 function );
-
-		return( -1 );
-	}
-	if( hive_bins_list->io_handle == NULL )
+	if( key_item->class_name != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bins list - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - class name value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_values_list_elements == 0 )
-	{
-		return( 1 );
-	}
-	if( ( values_list_offset == 0 )
-	 || ( values_list_offset == 0xffffffffUL ) )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid values list offset.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libregf_hive_bins_list_get_cell_at_offset(
-	     hive_bins_list,
-	     file_io_handle,
-	     values_list_offset,
-	     &hive_bin_cell,
-	     error ) != 1 )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-		 function,
-		 values_list_offset ,
-		 values_list_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	hive_bin_cell_size = hive_bin_cell->size;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1099,388 +1252,1251 @@ int libregf_key_item_read_values_list(
 		 "%s: data:\n",
 		 function );
 		libcnotify_print_data(
-		 hive_bin_cell->data,
-		 hive_bin_cell_size,
+		 data,
+		 data_size,
 		 0 );
 	}
 #endif
-	if( ( hive_bins_list->io_handle->major_version == 1 )
-	 && ( hive_bins_list->io_handle->minor_version <= 1 ) )
+	if( ( class_name_size == 0 )
+	 || ( (size_t) class_name_size > data_size ) )
 	{
-		data_offset += 4;
-	}
-	if( ( data_offset > hive_bin_cell_size )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid class name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	key_item->class_name = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * (size_t) class_name_size );
+
+	if( key_item->class_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create class name.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     key_item->class_name,
+	     data,
+	     (size_t) class_name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to class name.",
+		 function );
+
+		goto on_error;
+	}
+	key_item->class_name_size = class_name_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libregf_debug_print_utf16_string_value(
+		     function,
+		     "class name\t\t\t",
+		     key_item->class_name,
+		     (size_t) key_item->class_name_size,
+		     LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print UTF-16 string value.",
+			 function );
+
+			goto on_error;
+		}
+		if( (size_t) class_name_size < data_size )
+		{
+			libcnotify_printf(
+			 "%s: padding:\n",
+			 function );
+			libcnotify_print_data(
+			 &( data[ (size_t) class_name_size ] ),
+			 data_size - (size_t) class_name_size,
+			 0 );
+		}
+		else
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+
+on_error:
+	if( key_item->class_name != NULL )
+	{
+		memory_free(
+		 key_item->class_name );
+
+		key_item->class_name = NULL;
+	}
+	key_item->class_name_size = 0;
+
+	return( -1 );
+}
+
+/* Reads a class name
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_read_class_name(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t class_name_offset,
+     uint16_t class_name_size,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t hive_bin_cell;
+	static char *function                  = "libregf_key_item_read_class_name";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->class_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - class name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( class_name_offset == 0xffffffffUL )
+	{
+		return( 1 );
+	}
+	if( ( class_name_offset == 0 )
+	 && ( class_name_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( class_name_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid class name offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading class name at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 function,
+		 class_name_offset,
+		 class_name_offset );
+	}
+#endif
+	if( libregf_hive_bins_list_get_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     class_name_offset,
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 class_name_offset,
+		 class_name_offset );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_class_name_data(
+	     key_item,
+	     hive_bin_cell.data,
+	     hive_bin_cell.size,
+	     class_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 class_name_offset,
+		 class_name_offset );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads a security key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_read_security_key(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t security_key_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_read_security_key";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->security_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - security key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_key_offset == 0 )
+	 || ( security_key_offset == 0xffffffffUL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid security key offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The security key is shared by all the keys that reference it
+	 */
+	if( libregf_hive_bins_list_get_security_key_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     security_key_offset,
+	     &( key_item->security_key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		key_item->security_key = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a values list
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_read_values_list(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t values_list_offset,
+     uint32_t number_of_values_list_elements,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t hive_bin_cell;
+	static char *function                  = "libregf_key_item_read_values_list";
+	size_t data_offset                     = 0;
+	size_t hive_bin_cell_size              = 0;
+	uint32_t values_list_element_index     = 0;
+	uint32_t values_list_element_offset    = 0;
+	int element_index                      = 0;
+	int hive_bin_index                     = 0;
+	int result                             = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values_list_elements == 0 )
+	{
+		return( 1 );
+	}
+	if( ( values_list_offset == 0 )
+	 || ( values_list_offset == 0xffffffffUL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid values list offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bins_list_get_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     values_list_offset,
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 values_list_offset ,
+		 values_list_offset );
+
+		goto on_error;
+	}
+	hive_bin_cell_size = hive_bin_cell.size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data:\n",
+		 function );
+		libcnotify_print_data(
+		 hive_bin_cell.data,
+		 hive_bin_cell_size,
+		 0 );
+	}
+#endif
+	if( ( hive_bins_list->io_handle->major_version == 1 )
+	 && ( hive_bins_list->io_handle->minor_version <= 1 ) )
+	{
+		data_offset += 4;
+	}
+	if( ( data_offset > hive_bin_cell_size )
 	 || ( number_of_values_list_elements > ( ( hive_bin_cell_size - data_offset ) / 4 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid cell size value too small to contain number of values.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cell size value too small to contain number of values.",
+		 function );
+
+		goto on_error;
+	}
+	for( values_list_element_index = 0;
+	     values_list_element_index < number_of_values_list_elements;
+	     values_list_element_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( hive_bin_cell.data[ data_offset ] ),
+		 values_list_element_offset );
+
+		data_offset += 4;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: element: %03" PRIu32 " offset\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 values_list_element_index,
+			 values_list_element_offset );
+		}
+#endif
+		result = libregf_hive_bins_list_get_index_at_offset(
+		          hive_bins_list,
+		          (off64_t) values_list_element_offset,
+		          &hive_bin_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if values list element offset is valid.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+		}
+		else
+		{
+			if( libfdata_list_append_element(
+			     key_item->values_list,
+			     &element_index,
+			     0,
+			     (off64_t) values_list_element_offset,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to set value list element: %" PRIu32 " in list.",
+				 function,
+				 values_list_element_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( data_offset < hive_bin_cell_size )
+		{
+			libcnotify_printf(
+			 "%s: padding:\n",
+			 function );
+			libcnotify_print_data(
+			 &( hive_bin_cell.data[ data_offset ] ),
+			 hive_bin_cell_size - data_offset,
+			 0 );
+		}
+		else
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads a sub keys list
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libregf_key_item_read_sub_keys_list(
+     libcdata_array_t *sub_key_descriptors,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     off64_t sub_keys_list_offset,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t hive_bin_cell;
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_sub_key_list_t *sub_key_list         = NULL;
+	static char *function                        = "libregf_key_item_read_sub_keys_list";
+	int corruption_detected                      = 0;
+	int entry_index                              = 0;
+	int hive_bin_index                           = 0;
+	int number_of_sub_key_descriptors            = 0;
+	int result                                   = 0;
+	int sub_key_descriptor_index                 = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_keys_list_offset == 0 )
+	 || ( sub_keys_list_offset == (off64_t) 0xffffffffUL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid sub keys list offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBREGF_MAXIMUM_SUB_KEY_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bins_list_get_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     (uint32_t) sub_keys_list_offset,
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 sub_keys_list_offset,
+		 sub_keys_list_offset );
+
+		goto on_error;
+	}
+	if( libregf_sub_key_list_initialize(
+	     &sub_key_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub key list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_sub_key_list_read_data(
+	     sub_key_list,
+	     hive_bins_list->io_handle,
+	     hive_bin_cell.data,
+	     hive_bin_cell.size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub key list at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 sub_keys_list_offset,
+		 sub_keys_list_offset );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sub_key_list->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_descriptor_index = 0;
+	     sub_key_descriptor_index < number_of_sub_key_descriptors;
+	     sub_key_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sub_key_list->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( sub_key_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		result = libregf_hive_bins_list_get_index_at_offset(
+		          hive_bins_list,
+		          (off64_t) sub_key_descriptor->key_offset,
+		          &hive_bin_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if sub keys list element: %d offset is valid.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( sub_key_list->at_leaf_level != 0 )
+			{
+				if( libcdata_array_set_entry_by_index(
+				     sub_key_list->sub_key_descriptors,
+				     sub_key_descriptor_index,
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set sub key descriptor: %d in array.",
+					 function,
+					 sub_key_descriptor_index );
+
+					goto on_error;
+				}
+				if( libcdata_array_append_entry(
+				     sub_key_descriptors,
+				     &entry_index,
+				     (intptr_t *) sub_key_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append sub key descriptor to array.",
+					 function );
+
+					libregf_key_descriptor_free(
+					 &sub_key_descriptor,
+					 NULL );
+
+					goto on_error;
+				}
+				sub_key_descriptor = NULL;
+			}
+			else
+			{
+				result = libregf_key_item_read_sub_keys_list(
+					  sub_key_descriptors,
+					  file_io_handle,
+					  hive_bins_list,
+				          (off64_t) sub_key_descriptor->key_offset,
+				          recursion_depth + 1,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub keys list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 sub_key_descriptor->key_offset,
+					 sub_key_descriptor->key_offset );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			corruption_detected = 1;
+		}
+	}
+	if( libregf_sub_key_list_free(
+	     &sub_key_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub key list.",
+		 function );
+
+		goto on_error;
+	}
+	if( corruption_detected != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
+	if( sub_key_list != NULL )
+	{
+		libregf_sub_key_list_free(
+		 &sub_key_list,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 sub_key_descriptors,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the sub key name hash index
+ * The name hash of a sub key is the "lh" hash value, if available, otherwise
+ * the named key of the sub key is read to determine its name hash
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_read_sub_key_name_hash_index(
+     libregf_key_item_t *key_item,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_named_key_t *named_key               = NULL;
+	static char *function                        = "libregf_key_item_read_sub_key_name_hash_index";
+	int number_of_sub_key_descriptors            = 0;
+	int result                                   = 0;
+	int sub_key_descriptor_index                 = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
 		 function );
 
 		return( -1 );
 	}
-	for( values_list_element_index = 0;
-	     values_list_element_index < number_of_values_list_elements;
-	     values_list_element_index++ )
+	if( key_item->sub_key_name_hash_index != NULL )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( hive_bin_cell->data[ data_offset ] ),
-		 values_list_element_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - sub key name hash index value already set.",
+		 function );
 
-		data_offset += 4;
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: element: %03" PRIu32 " offset\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 values_list_element_index,
-			 values_list_element_offset );
-		}
-#endif
-		result = libregf_hive_bins_list_get_index_at_offset(
-		          hive_bins_list,
-		          (off64_t) values_list_element_offset,
-		          &hive_bin_index,
-		          error );
+		goto on_error;
+	}
+	if( number_of_sub_key_descriptors == 0 )
+	{
+		return( 1 );
+	}
+	if( libregf_name_hash_index_initialize(
+	     &( key_item->sub_key_name_hash_index ),
+	     number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub key name hash index.",
+		 function );
 
-		if( result == -1 )
+		goto on_error;
+	}
+	/* The entries are set in reverse order so that sub keys with the same name hash
+	 * are retrieved in the order of the sub keys list
+	 */
+	for( sub_key_descriptor_index = number_of_sub_key_descriptors - 1;
+	     sub_key_descriptor_index >= 0;
+	     sub_key_descriptor_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &sub_key_descriptor,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if values list element offset is valid.",
-			 function );
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result == 0 )
+		if( sub_key_descriptor == NULL )
 		{
-			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
 		}
-		else
+		/* The "lh" hash value is the name hash hence the named key does not need to be read
+		 */
+		if( ( sub_key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+		 && ( sub_key_descriptor->hash_value != 0 ) )
 		{
-			if( libfdata_list_append_element(
-			     key_item->values_list,
-			     &element_index,
-			     0,
-			     (off64_t) values_list_element_offset,
-			     0,
-			     0,
+			if( libregf_name_hash_index_set_entry(
+			     key_item->sub_key_name_hash_index,
+			     sub_key_descriptor_index,
+			     sub_key_descriptor->hash_value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-				 "%s: unable to set value list element: %" PRIu32 " in list.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sub key name hash index entry: %d.",
 				 function,
-				 values_list_element_index );
+				 sub_key_descriptor_index );
 
-				return( -1 );
+				goto on_error;
 			}
+			continue;
 		}
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( data_offset < hive_bin_cell_size )
+		if( libregf_named_key_initialize(
+		     &named_key,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: padding:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create named key.",
 			 function );
-			libcnotify_print_data(
-			 &( hive_bin_cell->data[ data_offset ] ),
-			 hive_bin_cell_size - data_offset,
-			 0 );
+
+			goto on_error;
 		}
-		else
+		result = libregf_key_item_read_named_key(
+		          named_key,
+		          key_item->file_io_handle,
+		          key_item->hive_bins_list,
+		          sub_key_descriptor->key_offset,
+		          0,
+		          error );
+
+		if( result != 1 )
 		{
-			libcnotify_printf(
-			 "\n" );
+			/* A sub key that cannot be read is not added to the index
+			 * and hence cannot be found by name
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+				 function,
+				 sub_key_descriptor->key_offset,
+				 sub_key_descriptor->key_offset );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
 		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		else if( libregf_name_hash_index_set_entry(
+		          key_item->sub_key_name_hash_index,
+		          sub_key_descriptor_index,
+		          named_key->name_hash,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sub key name hash index entry: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( libregf_named_key_free(
+		     &named_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free named key.",
+			 function );
 
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
+	}
+	if( key_item->sub_key_name_hash_index != NULL )
+	{
+		libregf_name_hash_index_free(
+		 &( key_item->sub_key_name_hash_index ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads a sub keys list
- * Returns 1 if successful, 0 if not or -1 on error
+/* Reads the value name hash index
+ * The value items of all the values are read to determine their name hash
+ * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_read_sub_keys_list(
-     libcdata_array_t *sub_key_descriptors,
-     libbfio_handle_t *file_io_handle,
-     libregf_hive_bins_list_t *hive_bins_list,
-     off64_t sub_keys_list_offset,
-     int recursion_depth,
+int libregf_key_item_read_value_name_hash_index(
+     libregf_key_item_t *key_item,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell       = NULL;
-	libregf_key_descriptor_t *sub_key_descriptor = NULL;
-	libregf_sub_key_list_t *sub_key_list         = NULL;
-	static char *function                        = "libregf_key_item_read_sub_keys_list";
-	int corruption_detected                      = 0;
-	int entry_index                              = 0;
-	int hive_bin_index                           = 0;
-	int number_of_sub_key_descriptors            = 0;
+	libfdata_list_element_t *values_list_element = NULL;
+	libregf_value_item_t *value_item             = NULL;
+	static char *function                        = "libregf_key_item_read_value_name_hash_index";
+	int number_of_values                         = 0;
 	int result                                   = 0;
-	int sub_key_descriptor_index                 = 0;
+	int value_index                              = 0;
 
-	if( hive_bins_list == NULL )
+	if( key_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 "%s: invalid key item.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( sub_keys_list_offset == 0 )
-	 || ( sub_keys_list_offset == (off64_t) 0xffffffffUL ) )
+	if( key_item->value_name_hash_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid sub keys list offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - value name hash index value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBREGF_MAXIMUM_SUB_KEY_RECURSION_DEPTH ) )
+	if( key_item->hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - missing hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	if( libregf_hive_bins_list_get_cell_at_offset(
-	     hive_bins_list,
-	     file_io_handle,
-	     (uint32_t) sub_keys_list_offset,
-	     &hive_bin_cell,
-	     error ) != 1 )
+	if( key_item->hive_bins_list->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 sub_keys_list_offset,
-		 sub_keys_list_offset );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - invalid hive bins list - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libregf_sub_key_list_initialize(
-	     &sub_key_list,
+	if( key_item->values_list == NULL )
+	{
+		return( 1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     key_item->values_list,
+	     &number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sub key list.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from values data list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libregf_sub_key_list_read_data(
-	     sub_key_list,
-	     hive_bins_list->io_handle,
-	     hive_bin_cell->data,
-	     hive_bin_cell->size,
-	     error ) != 1 )
+	if( number_of_values == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read sub key list at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 sub_keys_list_offset,
-		 sub_keys_list_offset );
-
-		goto on_error;
+		return( 1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     sub_key_list->sub_key_descriptors,
-	     &number_of_sub_key_descriptors,
+	if( libregf_name_hash_index_initialize(
+	     &( key_item->value_name_hash_index ),
+	     number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value name hash index.",
 		 function );
 
 		goto on_error;
 	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     sub_key_list->sub_key_descriptors,
-		     sub_key_descriptor_index,
-		     (intptr_t **) &sub_key_descriptor,
+	/* The entries are set in reverse order so that values with the same name hash
+	 * are retrieved in the order of the values list
+	 */
+	for( value_index = number_of_values - 1;
+	     value_index >= 0;
+	     value_index-- )
+	{
+		if( libfdata_list_get_list_element_by_index(
+		     key_item->values_list,
+		     value_index,
+		     &values_list_element,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 "%s: unable to retrieve value item: %d.",
 			 function,
-			 sub_key_descriptor_index );
+			 value_index );
 
 			goto on_error;
 		}
-		if( sub_key_descriptor == NULL )
+		if( libregf_io_handle_increment_counter(
+		     key_item->hive_bins_list->io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_LOOKUPS,
+		     1,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sub key descriptor: %d.",
-			 function,
-			 sub_key_descriptor_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment values cache lookups.",
+			 function );
 
 			goto on_error;
 		}
-		result = libregf_hive_bins_list_get_index_at_offset(
-		          hive_bins_list,
-		          (off64_t) sub_key_descriptor->key_offset,
-		          &hive_bin_index,
+		result = libfdata_list_element_get_element_value(
+		          values_list_element,
+		          (intptr_t *) key_item->file_io_handle,
+		          (libfdata_cache_t *) key_item->values_cache,
+		          (intptr_t **) &value_item,
+		          0,
 		          error );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if sub keys list element: %d offset is valid.",
-			 function,
-			 sub_key_descriptor_index );
-
-			goto on_error;
-		}
-		else if( result != 0 )
+		if( ( result != 1 )
+		 || ( value_item == NULL )
+		 || ( value_item->value_key == NULL ) )
 		{
-			if( sub_key_list->at_leaf_level != 0 )
+			/* A value that cannot be read is not added to the index
+			 * and hence cannot be found by name
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				if( libcdata_array_set_entry_by_index(
-				     sub_key_list->sub_key_descriptors,
-				     sub_key_descriptor_index,
-				     NULL,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set sub key descriptor: %d in array.",
-					 function,
-					 sub_key_descriptor_index );
+				libcnotify_printf(
+				 "%s: unable to read value item: %d.\n",
+				 function,
+				 value_index );
 
-					goto on_error;
-				}
-				if( libcdata_array_append_entry(
-				     sub_key_descriptors,
-				     &entry_index,
-				     (intptr_t *) sub_key_descriptor,
-				     error ) != 1 )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append sub key descriptor to array.",
-					 function );
-
-					libregf_key_descriptor_free(
-					 &sub_key_descriptor,
-					 NULL );
-
-					goto on_error;
+					libcnotify_print_error_backtrace(
+					 *error );
 				}
-				sub_key_descriptor = NULL;
 			}
-			else
-			{
-				result = libregf_key_item_read_sub_keys_list(
-					  sub_key_descriptors,
-					  file_io_handle,
-					  hive_bins_list,
-				          (off64_t) sub_key_descriptor->key_offset,
-				          recursion_depth + 1,
-					  error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read sub keys list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-					 function,
-					 sub_key_descriptor->key_offset,
-					 sub_key_descriptor->key_offset );
+#endif
+			libcerror_error_free(
+			 error );
 
-					goto on_error;
-				}
-			}
+			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
 		}
-		if( result == 0 )
+		else if( libregf_name_hash_index_set_entry(
+		          key_item->value_name_hash_index,
+		          value_index,
+		          value_item->value_key->name_hash,
+		          error ) != 1 )
 		{
-			corruption_detected = 1;
-		}
-	}
-	if( libregf_sub_key_list_free(
-	     &sub_key_list,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free sub key list.",
-		 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value name hash index entry: %d.",
+			 function,
+			 value_index );
 
-		goto on_error;
-	}
-	if( corruption_detected != 0 )
-	{
-		return( 0 );
+			goto on_error;
+		}
 	}
 	return( 1 );
 
 on_error:
-	if( sub_key_list != NULL )
+	if( key_item->value_name_hash_index != NULL )
 	{
-		libregf_sub_key_list_free(
-		 &sub_key_list,
+		libregf_name_hash_index_free(
+		 &( key_item->value_name_hash_index ),
 		 NULL );
 	}
-	libcdata_array_empty(
-	 sub_key_descriptors,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
-	 NULL );
-
 	return( -1 );
 }
 
@@ -1504,6 +2520,20 @@ int libregf_key_item_is_corrupted(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS | LIBREGF_KEY_ITEM_READ_FLAG_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys and values.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->item_flags & LIBREGF_ITEM_FLAG_IS_CORRUPTED ) != 0 )
 	{
 		return( 1 );
@@ -1780,6 +2810,20 @@ int libregf_key_item_get_class_name_size(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( class_name_size == NULL )
 	{
 		libcerror_error_set(
@@ -1823,6 +2867,20 @@ int libregf_key_item_get_class_name(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( class_name == NULL )
 	{
 		libcerror_error_set(
@@ -1904,6 +2962,20 @@ int libregf_key_item_get_utf8_class_name_size(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -1956,6 +3028,20 @@ int libregf_key_item_get_utf8_class_name(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -2007,6 +3093,20 @@ int libregf_key_item_get_utf16_class_name_size(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -2059,6 +3159,20 @@ int libregf_key_item_get_utf16_class_name(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -2079,20 +3193,259 @@ int libregf_key_item_get_utf16_class_name(
 		 "%s: unable to retrieve UTF-16 string.",
 		 function );
 
-		return( 1 );
+		return( 1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the 64-bit FILETIME value of the last written date and time
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_get_last_written_time(
+     libregf_key_item_t *key_item,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_last_written_time";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_named_key_get_last_written_time(
+	     key_item->named_key,
+	     filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last written time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the security descriptor size
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_key_item_get_security_descriptor_size(
+     libregf_key_item_t *key_item,
+     size_t *security_descriptor_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_security_descriptor_size";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_KEY,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read security key.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->security_key == NULL )
+	 || ( key_item->security_key->security_descriptor == NULL )
+	 || ( key_item->security_key->security_descriptor_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*security_descriptor_size = key_item->security_key->security_descriptor_size;
+
+	return( 1 );
+}
+
+/* Retrieves the security descriptor
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_key_item_get_security_descriptor(
+     libregf_key_item_t *key_item,
+     uint8_t *security_descriptor,
+     size_t security_descriptor_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_security_descriptor";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_KEY,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read security key.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid security descriptor size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->security_key == NULL )
+	 || ( key_item->security_key->security_descriptor == NULL )
+	 || ( key_item->security_key->security_descriptor_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( security_descriptor_size < key_item->security_key->security_descriptor_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid security descriptor size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     security_descriptor,
+	     key_item->security_key->security_descriptor,
+	     key_item->security_key->security_descriptor_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_get_number_of_values(
+     libregf_key_item_t *key_item,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_number_of_values";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     key_item->values_list,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from values data list.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the 64-bit FILETIME value of the last written date and time
+/* Retrieves the number of sub key descriptors
  * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_get_last_written_time(
+int libregf_key_item_get_number_of_sub_key_descriptors(
      libregf_key_item_t *key_item,
-     uint64_t *filetime,
+     int *number_of_sub_key_descriptors,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_get_last_written_time";
+	static char *function = "libregf_key_item_get_number_of_sub_key_descriptors";
 
 	if( key_item == NULL )
 	{
@@ -2105,16 +3458,30 @@ int libregf_key_item_get_last_written_time(
 
 		return( -1 );
 	}
-	if( libregf_named_key_get_last_written_time(
-	     key_item->named_key,
-	     filetime,
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     number_of_sub_key_descriptors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last written time.",
+		 "%s: unable to retrieve number of sub key descriptors.",
 		 function );
 
 		return( -1 );
@@ -2122,15 +3489,16 @@ int libregf_key_item_get_last_written_time(
 	return( 1 );
 }
 
-/* Retrieves the security descriptor size
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Retrieves a specific sub key descriptor
+ * Returns 1 if successful or -1 on error
  */
-int libregf_key_item_get_security_descriptor_size(
+int libregf_key_item_get_sub_key_descriptor_by_index(
      libregf_key_item_t *key_item,
-     size_t *security_descriptor_size,
+     int sub_key_descriptor_index,
+     libregf_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_get_security_descriptor_size";
+	static char *function = "libregf_key_item_get_sub_key_descriptor_by_index";
 
 	if( key_item == NULL )
 	{
@@ -2143,37 +3511,65 @@ int libregf_key_item_get_security_descriptor_size(
 
 		return( -1 );
 	}
-	if( security_descriptor_size == NULL )
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid security descriptor size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( key_item->security_descriptor == NULL )
-	 || ( key_item->security_descriptor_size == 0 ) )
+	if( libcdata_array_get_entry_by_index(
+	     key_item->sub_key_descriptors,
+             sub_key_descriptor_index,
+	     (intptr_t **) sub_key_descriptor,
+	     error ) != 1 )
 	{
-		return( 0 );
-	}
-	*security_descriptor_size = key_item->security_descriptor_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key descriptor: %d.",
+		 function,
+		 sub_key_descriptor_index );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the security descriptor
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Searches the sorted sub key descriptors for the specific UTF-8 encoded name
+ * Windows keeps the sub key list sorted by upper case name, hence a binary search
+ * only needs to read the named keys of a logarithmic number of sub keys
+ * The sort order is not guaranteed for corrupted or hives not written by Windows,
+ * hence if no match is found a lookup that does not depend on the sort order is needed
+ * Returns 1 if successful, 0 if no such sub key descriptor or -1 on error
  */
-int libregf_key_item_get_security_descriptor(
+int libregf_key_item_search_sub_key_descriptor_by_utf8_name(
      libregf_key_item_t *key_item,
-     uint8_t *security_descriptor,
-     size_t security_descriptor_size,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libregf_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_get_security_descriptor";
+	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
+	libregf_named_key_t *named_key                    = NULL;
+	static char *function                             = "libregf_key_item_search_sub_key_descriptor_by_utf8_name";
+	uint32_t named_key_hash                           = 0;
+	int compare_result                                = 0;
+	int lower_sub_key_descriptor_index                = 0;
+	int number_of_sub_key_descriptors                 = 0;
+	int result                                        = 0;
+	int sub_key_descriptor_index                      = 0;
+	int upper_sub_key_descriptor_index                = 0;
 
 	if( key_item == NULL )
 	{
@@ -2186,108 +3582,233 @@ int libregf_key_item_get_security_descriptor(
 
 		return( -1 );
 	}
-	if( security_descriptor == NULL )
+	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid security descriptor.",
+		 "%s: invalid hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	if( security_descriptor_size > (size_t) SSIZE_MAX )
+	if( hive_bins_list->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid security descriptor size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( key_item->security_descriptor == NULL )
-	 || ( key_item->security_descriptor_size == 0 ) )
-	{
-		return( 0 );
-	}
-	if( security_descriptor_size < key_item->security_descriptor_size )
+	if( sub_key_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid security descriptor size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_copy(
-	     security_descriptor,
-	     key_item->security_descriptor,
-	     key_item->security_descriptor_size ) == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy security descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
-
-/* Retrieves the number of values
- * Returns 1 if successful or -1 on error
- */
-int libregf_key_item_get_number_of_values(
-     libregf_key_item_t *key_item,
-     int *number_of_values,
-     libcerror_error_t **error )
-{
-	static char *function = "libregf_key_item_get_number_of_values";
+	upper_sub_key_descriptor_index = number_of_sub_key_descriptors;
 
-	if( key_item == NULL )
+	while( lower_sub_key_descriptor_index < upper_sub_key_descriptor_index )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
-		 function );
+		sub_key_descriptor_index = lower_sub_key_descriptor_index
+		                         + ( ( upper_sub_key_descriptor_index - lower_sub_key_descriptor_index ) / 2 );
 
-		return( -1 );
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &safe_sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( safe_sub_key_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		named_key_hash = 0;
+
+		if( safe_sub_key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+		{
+			named_key_hash = safe_sub_key_descriptor->hash_value;
+		}
+		if( libregf_named_key_initialize(
+		     &named_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create named key.",
+			 function );
+
+			goto on_error;
+		}
+		result = libregf_key_item_read_named_key(
+		          named_key,
+		          file_io_handle,
+		          hive_bins_list,
+		          safe_sub_key_descriptor->key_offset,
+		          named_key_hash,
+		          error );
+
+		if( result != 1 )
+		{
+			/* A sub key that cannot be read ends the search, the lookup that
+			 * does not depend on the sort order will handle the sub key
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+				 function,
+				 safe_sub_key_descriptor->key_offset,
+				 safe_sub_key_descriptor->key_offset );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			compare_result = -1;
+		}
+		else
+		{
+			compare_result = libregf_named_key_compare_sort_order_with_utf8_string(
+			                  named_key,
+			                  utf8_string,
+			                  utf8_string_length,
+			                  hive_bins_list->io_handle->ascii_codepage,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare sort order of named key with UTF-8 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libregf_named_key_free(
+		     &named_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free named key.",
+			 function );
+
+			goto on_error;
+		}
+		if( compare_result == -1 )
+		{
+			break;
+		}
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
+		{
+			*sub_key_descriptor = safe_sub_key_descriptor;
+
+			return( 1 );
+		}
+		else if( compare_result == LIBUNA_COMPARE_LESS )
+		{
+			lower_sub_key_descriptor_index = sub_key_descriptor_index + 1;
+		}
+		else
+		{
+			upper_sub_key_descriptor_index = sub_key_descriptor_index;
+		}
 	}
-	if( libfdata_list_get_number_of_elements(
-	     key_item->values_list,
-	     number_of_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from values data list.",
-		 function );
+	return( 0 );
 
-		return( -1 );
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
 	}
-	return( 1 );
+	return( -1 );
 }
 
-/* Retrieves the number of sub key descriptors
- * Returns 1 if successful or -1 on error
+/* Searches the sorted sub key descriptors for the specific UTF-16 encoded name
+ * Windows keeps the sub key list sorted by upper case name, hence a binary search
+ * only needs to read the named keys of a logarithmic number of sub keys
+ * The sort order is not guaranteed for corrupted or hives not written by Windows,
+ * hence if no match is found a lookup that does not depend on the sort order is needed
+ * Returns 1 if successful, 0 if no such sub key descriptor or -1 on error
  */
-int libregf_key_item_get_number_of_sub_key_descriptors(
+int libregf_key_item_search_sub_key_descriptor_by_utf16_name(
      libregf_key_item_t *key_item,
-     int *number_of_sub_key_descriptors,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libregf_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_get_number_of_sub_key_descriptors";
+	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
+	libregf_named_key_t *named_key                    = NULL;
+	static char *function                             = "libregf_key_item_search_sub_key_descriptor_by_utf16_name";
+	uint32_t named_key_hash                           = 0;
+	int compare_result                                = 0;
+	int lower_sub_key_descriptor_index                = 0;
+	int number_of_sub_key_descriptors                 = 0;
+	int result                                        = 0;
+	int sub_key_descriptor_index                      = 0;
+	int upper_sub_key_descriptor_index                = 0;
 
 	if( key_item == NULL )
 	{
@@ -2300,65 +3821,213 @@ int libregf_key_item_get_number_of_sub_key_descriptors(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     key_item->sub_key_descriptors,
-	     number_of_sub_key_descriptors,
-	     error ) != 1 )
+	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub key descriptors.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific sub key descriptor
- * Returns 1 if successful or -1 on error
- */
-int libregf_key_item_get_sub_key_descriptor_by_index(
-     libregf_key_item_t *key_item,
-     int sub_key_descriptor_index,
-     libregf_key_descriptor_t **sub_key_descriptor,
-     libcerror_error_t **error )
-{
-	static char *function = "libregf_key_item_get_sub_key_descriptor_by_index";
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
 
-	if( key_item == NULL )
+		return( -1 );
+	}
+	if( sub_key_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
+		 "%s: invalid sub key descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
+	if( libcdata_array_get_number_of_entries(
 	     key_item->sub_key_descriptors,
-             sub_key_descriptor_index,
-	     (intptr_t **) sub_key_descriptor,
+	     &number_of_sub_key_descriptors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub key descriptor: %d.",
-		 function,
-		 sub_key_descriptor_index );
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
+	upper_sub_key_descriptor_index = number_of_sub_key_descriptors;
+
+	while( lower_sub_key_descriptor_index < upper_sub_key_descriptor_index )
+	{
+		sub_key_descriptor_index = lower_sub_key_descriptor_index
+		                         + ( ( upper_sub_key_descriptor_index - lower_sub_key_descriptor_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &safe_sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( safe_sub_key_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		named_key_hash = 0;
+
+		if( safe_sub_key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+		{
+			named_key_hash = safe_sub_key_descriptor->hash_value;
+		}
+		if( libregf_named_key_initialize(
+		     &named_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create named key.",
+			 function );
+
+			goto on_error;
+		}
+		result = libregf_key_item_read_named_key(
+		          named_key,
+		          file_io_handle,
+		          hive_bins_list,
+		          safe_sub_key_descriptor->key_offset,
+		          named_key_hash,
+		          error );
+
+		if( result != 1 )
+		{
+			/* A sub key that cannot be read ends the search, the lookup that
+			 * does not depend on the sort order will handle the sub key
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+				 function,
+				 safe_sub_key_descriptor->key_offset,
+				 safe_sub_key_descriptor->key_offset );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			compare_result = -1;
+		}
+		else
+		{
+			compare_result = libregf_named_key_compare_sort_order_with_utf16_string(
+			                  named_key,
+			                  utf16_string,
+			                  utf16_string_length,
+			                  hive_bins_list->io_handle->ascii_codepage,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare sort order of named key with UTF-16 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libregf_named_key_free(
+		     &named_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free named key.",
+			 function );
+
+			goto on_error;
+		}
+		if( compare_result == -1 )
+		{
+			break;
+		}
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
+		{
+			*sub_key_descriptor = safe_sub_key_descriptor;
+
+			return( 1 );
+		}
+		else if( compare_result == LIBUNA_COMPARE_LESS )
+		{
+			lower_sub_key_descriptor_index = sub_key_descriptor_index + 1;
+		}
+		else
+		{
+			upper_sub_key_descriptor_index = sub_key_descriptor_index;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the sub key descriptor for the specific UTF-8 encoded name
+ * The "lh" hash or "lf" name hint of the sub key list is used to skip sub keys
+ * without reading their named key, the sub key name hash index is used if
+ * the name consists of ASCII characters
+ * If the sub key name hash index cannot be read without reading the named keys
+ * of all the sub keys, a binary search of the sorted sub keys is tried first
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
 int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
@@ -2374,6 +4043,11 @@ int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
 	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
 	libregf_named_key_t *named_key                    = NULL;
 	static char *function                             = "libregf_key_item_get_sub_key_descriptor_by_utf8_name";
+	uint32_t list_name_hash                           = 0;
+	uint32_t list_name_hint                           = 0;
+	uint32_t named_key_hash                           = 0;
+	uint8_t use_name_hash_index                       = 0;
+	int compare_result                                = 0;
 	int number_of_sub_key_descriptors                 = 0;
 	int result                                        = 0;
 	int sub_key_descriptor_index                      = 0;
@@ -2389,6 +4063,36 @@ int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
 
 		return( -1 );
 	}
+	if( libregf_key_descriptor_get_hash_values_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     &list_name_hash,
+	     &list_name_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sub key list hash values of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
 	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
@@ -2413,9 +4117,6 @@ int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
 	}
 	*sub_key_descriptor = NULL;
 
-/* TODO think of caching and/or optimization
- * e.g. mapping sub key descriptors to name search tree?
- */
 	if( libcdata_array_get_number_of_entries(
 	     key_item->sub_key_descriptors,
 	     &number_of_sub_key_descriptors,
@@ -2430,114 +4131,247 @@ int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
 
 		goto on_error;
 	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
+	if( number_of_sub_key_descriptors == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     key_item->sub_key_descriptors,
-		     sub_key_descriptor_index,
-		     (intptr_t **) &safe_sub_key_descriptor,
+		return( 0 );
+	}
+	if( ( list_name_hash == 0 )
+	 || ( key_item->sub_keys_have_name_hashes == 0 ) )
+	{
+		result = libregf_key_item_search_sub_key_descriptor_by_utf8_name(
+		          key_item,
+		          file_io_handle,
+		          hive_bins_list,
+		          utf8_string,
+		          utf8_string_length,
+		          sub_key_descriptor,
+		          error );
+
+		if( result != 0 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to search sorted sub key descriptors.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	/* The name hash index only contains the candidate sub keys, the name of
+	 * a candidate still needs to be compared since name hashes can collide
+	 */
+	if( list_name_hash != 0 )
+	{
+		if( libregf_key_item_read_on_demand(
+		     key_item,
+		     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEY_NAME_INDEX,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key descriptor: %d from array.",
-			 function,
-			 sub_key_descriptor_index );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub key name hash index.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( safe_sub_key_descriptor == NULL )
+		if( key_item->sub_key_name_hash_index != NULL )
+		{
+			use_name_hash_index = 1;
+		}
+	}
+	if( use_name_hash_index != 0 )
+	{
+		result = libregf_name_hash_index_get_first_entry_index(
+		          key_item->sub_key_name_hash_index,
+		          list_name_hash,
+		          &sub_key_descriptor_index,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sub key descriptor: %d.",
-			 function,
-			 sub_key_descriptor_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first entry from sub key name hash index.",
+			 function );
 
 			goto on_error;
 		}
-		if( libregf_named_key_initialize(
-		     &named_key,
+	}
+	else
+	{
+		sub_key_descriptor_index = 0;
+		result                   = 1;
+	}
+	while( result == 1 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &safe_sub_key_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create named key.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
 
 			goto on_error;
 		}
-		if( libregf_key_item_read_named_key(
-		     named_key,
-		     file_io_handle,
-		     hive_bins_list,
-		     safe_sub_key_descriptor->key_offset,
-		     safe_sub_key_descriptor->hash_value,
-		     error ) != 1 )
+		if( safe_sub_key_descriptor == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
 			 function,
-			 safe_sub_key_descriptor->key_offset,
-			 safe_sub_key_descriptor->key_offset );
+			 sub_key_descriptor_index );
 
 			goto on_error;
 		}
-		result = libregf_named_key_compare_name_with_utf8_string(
-		          named_key,
-		          name_hash,
-		          utf8_string,
-		          utf8_string_length,
-		          hive_bins_list->io_handle->ascii_codepage,
-		          error );
+		compare_result = libregf_key_descriptor_compare_hash_value(
+		                  safe_sub_key_descriptor,
+		                  list_name_hash,
+		                  list_name_hint,
+		                  error );
 
-		if( result == -1 )
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare named key with UTF-8 string.",
-			 function );
+			 "%s: unable to compare sub key descriptor: %d hash value.",
+			 function,
+			 sub_key_descriptor_index );
 
 			goto on_error;
 		}
-		if( libregf_named_key_free(
-		     &named_key,
-		     error ) != 1 )
+		/* Only read the named key if the hash value of the sub key list matches
+		 */
+		if( compare_result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free named key.",
-			 function );
+			/* Only the "lh" hash value can be compared with the name hash of the named key
+			 */
+			named_key_hash = 0;
 
-			goto on_error;
+			if( safe_sub_key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+			{
+				named_key_hash = safe_sub_key_descriptor->hash_value;
+			}
+			if( libregf_named_key_initialize(
+			     &named_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create named key.",
+				 function );
+
+				goto on_error;
+			}
+			if( libregf_key_item_read_named_key(
+			     named_key,
+			     file_io_handle,
+			     hive_bins_list,
+			     safe_sub_key_descriptor->key_offset,
+			     named_key_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 safe_sub_key_descriptor->key_offset,
+				 safe_sub_key_descriptor->key_offset );
+
+				goto on_error;
+			}
+			compare_result = libregf_named_key_compare_name_with_utf8_string(
+			                  named_key,
+			                  name_hash,
+			                  utf8_string,
+			                  utf8_string_length,
+			                  hive_bins_list->io_handle->ascii_codepage,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare named key with UTF-8 string.",
+				 function );
+
+				goto on_error;
+			}
+			if( libregf_named_key_free(
+			     &named_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free named key.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		if( result != 0 )
+		if( compare_result != 0 )
 		{
-			break;
+			*sub_key_descriptor = safe_sub_key_descriptor;
+
+			return( 1 );
 		}
-	}
-	if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
-	{
-		return( 0 );
-	}
-	*sub_key_descriptor = safe_sub_key_descriptor;
+		if( use_name_hash_index != 0 )
+		{
+			result = libregf_name_hash_index_get_next_entry_index(
+			          key_item->sub_key_name_hash_index,
+			          list_name_hash,
+			          &sub_key_descriptor_index,
+			          error );
 
-	return( 1 );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next entry from sub key name hash index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			sub_key_descriptor_index++;
+
+			if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
+			{
+				result = 0;
+			}
+		}
+	}
+	return( 0 );
 
 on_error:
 	if( named_key != NULL )
@@ -2550,6 +4384,11 @@ on_error:
 }
 
 /* Retrieves the sub key descriptor for the specific UTF-16 encoded name
+ * The "lh" hash or "lf" name hint of the sub key list is used to skip sub keys
+ * without reading their named key, the sub key name hash index is used if
+ * the name consists of ASCII characters
+ * If the sub key name hash index cannot be read without reading the named keys
+ * of all the sub keys, a binary search of the sorted sub keys is tried first
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
 int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
@@ -2565,6 +4404,11 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
 	libregf_named_key_t *named_key                    = NULL;
 	static char *function                             = "libregf_key_item_get_sub_key_descriptor_by_utf16_name";
+	uint32_t list_name_hash                           = 0;
+	uint32_t list_name_hint                           = 0;
+	uint32_t named_key_hash                           = 0;
+	uint8_t use_name_hash_index                       = 0;
+	int compare_result                                = 0;
 	int number_of_sub_key_descriptors                 = 0;
 	int result                                        = 0;
 	int sub_key_descriptor_index                      = 0;
@@ -2580,6 +4424,36 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 
 		return( -1 );
 	}
+	if( libregf_key_descriptor_get_hash_values_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     &list_name_hash,
+	     &list_name_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sub key list hash values of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_on_demand(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
 	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
@@ -2604,9 +4478,6 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 	}
 	*sub_key_descriptor = NULL;
 
-/* TODO think of caching and/or optimization
- * e.g. mapping sub key descriptors to name search tree?
- */
 	if( libcdata_array_get_number_of_entries(
 	     key_item->sub_key_descriptors,
 	     &number_of_sub_key_descriptors,
@@ -2621,9 +4492,86 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 
 		goto on_error;
 	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
+	if( number_of_sub_key_descriptors == 0 )
+	{
+		return( 0 );
+	}
+	if( ( list_name_hash == 0 )
+	 || ( key_item->sub_keys_have_name_hashes == 0 ) )
+	{
+		result = libregf_key_item_search_sub_key_descriptor_by_utf16_name(
+		          key_item,
+		          file_io_handle,
+		          hive_bins_list,
+		          utf16_string,
+		          utf16_string_length,
+		          sub_key_descriptor,
+		          error );
+
+		if( result != 0 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to search sorted sub key descriptors.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	/* The name hash index only contains the candidate sub keys, the name of
+	 * a candidate still needs to be compared since name hashes can collide
+	 */
+	if( list_name_hash != 0 )
+	{
+		if( libregf_key_item_read_on_demand(
+		     key_item,
+		     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEY_NAME_INDEX,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub key name hash index.",
+			 function );
+
+			return( -1 );
+		}
+		if( key_item->sub_key_name_hash_index != NULL )
+		{
+			use_name_hash_index = 1;
+		}
+	}
+	if( use_name_hash_index != 0 )
+	{
+		result = libregf_name_hash_index_get_first_entry_index(
+		          key_item->sub_key_name_hash_index,
+		          list_name_hash,
+		          &sub_key_descriptor_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first entry from sub key name hash index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		sub_key_descriptor_index = 0;
+		result                   = 1;
+	}
+	while( result == 1 )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     key_item->sub_key_descriptors,
@@ -2653,82 +4601,138 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 
 			goto on_error;
 		}
-		if( libregf_named_key_initialize(
-		     &named_key,
-		     error ) != 1 )
+		compare_result = libregf_key_descriptor_compare_hash_value(
+		                  safe_sub_key_descriptor,
+		                  list_name_hash,
+		                  list_name_hint,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create named key.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare sub key descriptor: %d hash value.",
+			 function,
+			 sub_key_descriptor_index );
 
 			goto on_error;
 		}
-		if( libregf_key_item_read_named_key(
-		     named_key,
-		     file_io_handle,
-		     hive_bins_list,
-		     safe_sub_key_descriptor->key_offset,
-		     safe_sub_key_descriptor->hash_value,
-		     error ) != 1 )
+		/* Only read the named key if the hash value of the sub key list matches
+		 */
+		if( compare_result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 safe_sub_key_descriptor->key_offset,
-			 safe_sub_key_descriptor->key_offset );
+			/* Only the "lh" hash value can be compared with the name hash of the named key
+			 */
+			named_key_hash = 0;
 
-			goto on_error;
-		}
-		result = libregf_named_key_compare_name_with_utf16_string(
-		          named_key,
-		          name_hash,
-		          utf16_string,
-		          utf16_string_length,
-		          hive_bins_list->io_handle->ascii_codepage,
-		          error );
+			if( safe_sub_key_descriptor->hash_type == LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH )
+			{
+				named_key_hash = safe_sub_key_descriptor->hash_value;
+			}
+			if( libregf_named_key_initialize(
+			     &named_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create named key.",
+				 function );
 
-		if( result == -1 )
+				goto on_error;
+			}
+			if( libregf_key_item_read_named_key(
+			     named_key,
+			     file_io_handle,
+			     hive_bins_list,
+			     safe_sub_key_descriptor->key_offset,
+			     named_key_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 safe_sub_key_descriptor->key_offset,
+				 safe_sub_key_descriptor->key_offset );
+
+				goto on_error;
+			}
+			compare_result = libregf_named_key_compare_name_with_utf16_string(
+			                  named_key,
+			                  name_hash,
+			                  utf16_string,
+			                  utf16_string_length,
+			                  hive_bins_list->io_handle->ascii_codepage,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare named key with UTF-16 string.",
+				 function );
+
+				goto on_error;
+			}
+			if( libregf_named_key_free(
+			     &named_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free named key.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( compare_result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare named key with UTF-16 string.",
-			 function );
+			*sub_key_descriptor = safe_sub_key_descriptor;
 
-			goto on_error;
+			return( 1 );
 		}
-		if( libregf_named_key_free(
-		     &named_key,
-		     error ) != 1 )
+		if( use_name_hash_index != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free named key.",
-			 function );
+			result = libregf_name_hash_index_get_next_entry_index(
+			          key_item->sub_key_name_hash_index,
+			          list_name_hash,
+			          &sub_key_descriptor_index,
+			          error );
 
-			goto on_error;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next entry from sub key name hash index.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		if( result != 0 )
+		else
 		{
-			break;
+			sub_key_descriptor_index++;
+
+			if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
+			{
+				result = 0;
+			}
 		}
 	}
-	if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
-	{
-		return( 0 );
-	}
-	*sub_key_descriptor = safe_sub_key_descriptor;
-
-	return( 1 );
+	return( 0 );
 
 on_error:
 	if( named_key != NULL )
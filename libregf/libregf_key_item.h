@@ -30,14 +30,24 @@
 #include "libregf_libbfio.h"
 #include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
+#include "libregf_name_hash_index.h"
 #include "libregf_named_key.h"
+#include "libregf_security_key.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The read flags are published with atomic operations when the compiler provides them,
+ * otherwise while holding the read/write lock
+ */
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ ) && defined( __ATOMIC_ACQUIRE )
+#define LIBREGF_KEY_ITEM_HAVE_ATOMIC_READ_FLAGS
+#endif
+
 typedef struct libregf_key_item libregf_key_item_t;
 
 struct libregf_key_item
@@ -54,13 +64,9 @@ struct libregf_key_item
 	 */
 	uint16_t class_name_size;
 
-	/* The security descriptor
+	/* The security key, which is shared with other key items
 	 */
-	uint8_t *security_descriptor;
-
-	/* The security descriptor size
-	 */
-	size_t security_descriptor_size;
+	libregf_security_key_t *security_key;
 
 	/* The values list
 	 */
@@ -70,13 +76,47 @@ struct libregf_key_item
 	 */
 	libfcache_cache_t *values_cache;
 
+	/* The value name hash index, which is read on the first lookup by name
+	 */
+	libregf_name_hash_index_t *value_name_hash_index;
+
 	/* The sub key descriptors
 	 */
 	libcdata_array_t *sub_key_descriptors;
 
+	/* The sub key name hash index, which is read on the first lookup by name
+	 */
+	libregf_name_hash_index_t *sub_key_name_hash_index;
+
+	/* Value to indicate all the sub key descriptors have a "lh" name hash
+	 */
+	uint8_t sub_keys_have_name_hashes;
+
 	/* Various item flags
 	 */
 	uint8_t item_flags;
+
+	/* The read flags, that indicate which parts have been read
+	 */
+	uint8_t read_flags;
+
+	/* The number of references, the key item is freed when the last reference is released
+	 */
+	int number_of_references;
+
+	/* The file IO handle, used to read the parts on demand
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The hive bins list, used to read the parts on demand
+	 */
+	libregf_hive_bins_list_t *hive_bins_list;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libregf_key_item_initialize(
@@ -87,6 +127,14 @@ int libregf_key_item_free(
      libregf_key_item_t **key_item,
      libcerror_error_t **error );
 
+int libregf_key_item_grab_reference(
+     libregf_key_item_t *key_item,
+     libcerror_error_t **error );
+
+int libregf_key_item_release_reference(
+     libregf_key_item_t **key_item,
+     libcerror_error_t **error );
+
 int libregf_key_item_read(
      libregf_key_item_t *key_item,
      libbfio_handle_t *file_io_handle,
@@ -95,6 +143,16 @@ int libregf_key_item_read(
      uint32_t named_key_hash,
      libcerror_error_t **error );
 
+int libregf_key_item_read_parts(
+     libregf_key_item_t *key_item,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+int libregf_key_item_read_on_demand(
+     libregf_key_item_t *key_item,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 int libregf_key_item_read_named_key(
      libregf_named_key_t *named_key,
      libbfio_handle_t *file_io_handle,
@@ -141,6 +199,14 @@ int libregf_key_item_read_sub_keys_list(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libregf_key_item_read_sub_key_name_hash_index(
+     libregf_key_item_t *key_item,
+     libcerror_error_t **error );
+
+int libregf_key_item_read_value_name_hash_index(
+     libregf_key_item_t *key_item,
+     libcerror_error_t **error );
+
 int libregf_key_item_is_corrupted(
      libregf_key_item_t *key_item,
      libcerror_error_t **error );
@@ -251,6 +317,24 @@ int libregf_key_item_get_sub_key_descriptor_by_index(
      libregf_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error );
 
+int libregf_key_item_search_sub_key_descriptor_by_utf8_name(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libregf_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error );
+
+int libregf_key_item_search_sub_key_descriptor_by_utf16_name(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libregf_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error );
+
 int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
      libregf_key_item_t *key_item,
      libbfio_handle_t *file_io_handle,
@@ -0,0 +1,565 @@
+/*
+ * Key item cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_definitions.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+
+/* Creates a key item cache
+ * Make sure the value key_item_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_initialize(
+     libregf_key_item_cache_t **key_item_cache,
+     libregf_io_handle_t *io_handle,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_initialize";
+	int entry_index       = 0;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_item_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libregf_key_item_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*key_item_cache = memory_allocate_structure(
+	                   libregf_key_item_cache_t );
+
+	if( *key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_item_cache,
+	     0,
+	     sizeof( libregf_key_item_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key item cache.",
+		 function );
+
+		memory_free(
+		 *key_item_cache );
+
+		*key_item_cache = NULL;
+
+		return( -1 );
+	}
+	( *key_item_cache )->key_offsets = (uint32_t *) memory_allocate(
+	                                                 sizeof( uint32_t ) * number_of_entries );
+
+	if( ( *key_item_cache )->key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *key_item_cache )->key_items = (libregf_key_item_t **) memory_allocate(
+	                                                          sizeof( libregf_key_item_t * ) * number_of_entries );
+
+	if( ( *key_item_cache )->key_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key items.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		( *key_item_cache )->key_offsets[ entry_index ] = 0;
+		( *key_item_cache )->key_items[ entry_index ]   = NULL;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *key_item_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *key_item_cache )->io_handle         = io_handle;
+	( *key_item_cache )->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *key_item_cache != NULL )
+	{
+		if( ( *key_item_cache )->key_items != NULL )
+		{
+			memory_free(
+			 ( *key_item_cache )->key_items );
+		}
+		if( ( *key_item_cache )->key_offsets != NULL )
+		{
+			memory_free(
+			 ( *key_item_cache )->key_offsets );
+		}
+		memory_free(
+		 *key_item_cache );
+
+		*key_item_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key item cache
+ * The references held by the cache are released, the key items that are
+ * still referenced by a key are freed when that key is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_free(
+     libregf_key_item_cache_t **key_item_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_item_cache != NULL )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *key_item_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The io_handle reference is freed elsewhere
+		 */
+		for( entry_index = 0;
+		     entry_index < ( *key_item_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( libregf_key_item_release_reference(
+			     &( ( *key_item_cache )->key_items[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release key item: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *key_item_cache )->key_items );
+
+		memory_free(
+		 ( *key_item_cache )->key_offsets );
+
+		memory_free(
+		 *key_item_cache );
+
+		*key_item_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the key item of a specific key offset
+ * The key item is read if it is not in the cache, a key item that is read
+ * replaces the entry with the same index in the cache
+ * The caller receives a reference to the key item, which must be released
+ * with libregf_key_item_release_reference
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_get_key_item(
+     libregf_key_item_cache_t *key_item_cache,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t named_key_hash,
+     libregf_key_item_t **key_item,
+     libcerror_error_t **error )
+{
+	libregf_key_item_t *cached_key_item  = NULL;
+	libregf_key_item_t *evicted_key_item = NULL;
+	static char *function                = "libregf_key_item_cache_get_key_item";
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Cells are 8-byte aligned, hence the lower 3 bits of the key offset are not used
+	 */
+	entry_index = (int) ( ( key_offset >> 3 ) % (uint32_t) key_item_cache->number_of_entries );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cached_key_item = key_item_cache->key_items[ entry_index ];
+
+	/* The statistics are updated while the cache is locked so that
+	 * they are consistent with the lookup
+	 */
+	if( libregf_io_handle_increment_counter(
+	     key_item_cache->io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_KEYS_CACHE_LOOKUPS,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment keys cache lookups.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( cached_key_item != NULL )
+	      && ( key_item_cache->key_offsets[ entry_index ] == key_offset ) )
+	{
+		/* The reference is grabbed while the cache is locked so that
+		 * the key item cannot be evicted and freed in the meantime
+		 */
+		result = libregf_key_item_grab_reference(
+		          cached_key_item,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab reference to key item.",
+			 function );
+
+			result = -1;
+		}
+	}
+	else if( libregf_io_handle_increment_counter(
+	          key_item_cache->io_handle,
+	          LIBREGF_IO_HANDLE_COUNTER_KEYS_CACHE_MISSES,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment keys cache misses.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		if( result == 1 )
+		{
+			libregf_key_item_release_reference(
+			 &cached_key_item,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	else if( result == 1 )
+	{
+		*key_item = cached_key_item;
+
+		return( 1 );
+	}
+	/* The key item is read without holding the lock so that lookups of
+	 * other keys are not blocked while reading
+	 */
+	if( libregf_key_item_initialize(
+	     key_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key item.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_item_read(
+	     *key_item,
+	     file_io_handle,
+	     hive_bins_list,
+	     (off64_t) key_offset,
+	     named_key_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		goto on_error;
+	}
+	/* The reference of the cache is grabbed before the key item is stored
+	 */
+	if( libregf_key_item_grab_reference(
+	     *key_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reference to key item.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libregf_key_item_release_reference(
+		 key_item,
+		 NULL );
+
+		goto on_error;
+	}
+#endif
+	evicted_key_item = key_item_cache->key_items[ entry_index ];
+
+	key_item_cache->key_offsets[ entry_index ] = key_offset;
+	key_item_cache->key_items[ entry_index ]   = *key_item;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The evicted key item is freed if no key references it
+	 */
+	if( libregf_key_item_release_reference(
+	     &evicted_key_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release evicted key item.",
+		 function );
+
+		libregf_key_item_release_reference(
+		 key_item,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( evicted_key_item != NULL )
+	{
+		libregf_key_item_release_reference(
+		 &evicted_key_item,
+		 NULL );
+	}
+	if( *key_item != NULL )
+	{
+		libregf_key_item_release_reference(
+		 key_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
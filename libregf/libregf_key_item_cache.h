@@ -0,0 +1,90 @@
+/*
+ * Key item cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_KEY_ITEM_CACHE_H )
+#define _LIBREGF_KEY_ITEM_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_key_item.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_key_item_cache libregf_key_item_cache_t;
+
+struct libregf_key_item_cache
+{
+	/* The IO handle
+	 */
+	libregf_io_handle_t *io_handle;
+
+	/* The key offset of every entry
+	 */
+	uint32_t *key_offsets;
+
+	/* The key item of every entry, the cache holds a reference to each of them
+	 */
+	libregf_key_item_t **key_items;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libregf_key_item_cache_initialize(
+     libregf_key_item_cache_t **key_item_cache,
+     libregf_io_handle_t *io_handle,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_free(
+     libregf_key_item_cache_t **key_item_cache,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_get_key_item(
+     libregf_key_item_cache_t *key_item_cache,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t named_key_hash,
+     libregf_key_item_t **key_item,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_KEY_ITEM_CACHE_H ) */
+
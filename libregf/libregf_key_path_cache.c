@@ -0,0 +1,1122 @@
+/*
+ * Key path cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_definitions.h"
+#include "libregf_file_header.h"
+#include "libregf_key_path_cache.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_libuna.h"
+
+#include "regf_key_path_index.h"
+
+const char *regf_key_path_index_signature = "rkpi";
+
+/* Creates a key path cache
+ * Make sure the value key_path_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_cache_initialize(
+     libregf_key_path_cache_t **key_path_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_path_cache_initialize";
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libregf_key_path_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*key_path_cache = memory_allocate_structure(
+	                   libregf_key_path_cache_t );
+
+	if( *key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_path_cache,
+	     0,
+	     sizeof( libregf_key_path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key path cache.",
+		 function );
+
+		memory_free(
+		 *key_path_cache );
+
+		*key_path_cache = NULL;
+
+		return( -1 );
+	}
+	( *key_path_cache )->entries = (libregf_key_path_cache_entry_t *) memory_allocate(
+	                                                                   sizeof( libregf_key_path_cache_entry_t ) * number_of_entries );
+
+	if( ( *key_path_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *key_path_cache )->entries,
+	     0,
+	     sizeof( libregf_key_path_cache_entry_t ) * number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *key_path_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *key_path_cache )->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *key_path_cache != NULL )
+	{
+		if( ( *key_path_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *key_path_cache )->entries );
+		}
+		memory_free(
+		 *key_path_cache );
+
+		*key_path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_cache_free(
+     libregf_key_path_cache_t **key_path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_path_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_path_cache != NULL )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *key_path_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( entry_index = 0;
+		     entry_index < ( *key_path_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( ( *key_path_cache )->entries[ entry_index ].path != NULL )
+			{
+				memory_free(
+				 ( *key_path_cache )->entries[ entry_index ].path );
+			}
+		}
+		memory_free(
+		 ( *key_path_cache )->entries );
+
+		memory_free(
+		 *key_path_cache );
+
+		*key_path_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the key offset of a specific path
+ * The path is relative to the key at the base key offset and contains
+ * upper case characters
+ * Returns 1 if successful, 0 if the path is not in the cache or -1 on error
+ */
+int libregf_key_path_cache_get_key_offset(
+     libregf_key_path_cache_t *key_path_cache,
+     uint32_t base_key_offset,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	libregf_key_path_cache_entry_t *entry = NULL;
+	static char *function                 = "libregf_key_path_cache_get_key_offset";
+	int result                            = 0;
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = &( key_path_cache->entries[ path_hash % (uint32_t) key_path_cache->number_of_entries ] );
+
+	/* The path is compared since path hashes can collide
+	 */
+	if( ( entry->path != NULL )
+	 && ( entry->base_key_offset == base_key_offset )
+	 && ( entry->path_hash == path_hash )
+	 && ( entry->path_length == path_length )
+	 && ( memory_compare(
+	       entry->path,
+	       path,
+	       sizeof( libuna_unicode_character_t ) * path_length ) == 0 ) )
+	{
+		*key_offset = entry->key_offset;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the key offset of a specific path
+ * The path is relative to the key at the base key offset and contains
+ * upper case characters
+ * The path replaces the entry with the same index in the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_cache_set_key_offset(
+     libregf_key_path_cache_t *key_path_cache,
+     uint32_t base_key_offset,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     uint32_t key_offset,
+     libcerror_error_t **error )
+{
+	libregf_key_path_cache_entry_t *entry  = NULL;
+	libuna_unicode_character_t *entry_path = NULL;
+	static char *function                  = "libregf_key_path_cache_set_key_offset";
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_path = (libuna_unicode_character_t *) memory_allocate(
+	                                             sizeof( libuna_unicode_character_t ) * path_length );
+
+	if( entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     entry_path,
+	     path,
+	     sizeof( libuna_unicode_character_t ) * path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry path.",
+		 function );
+
+		memory_free(
+		 entry_path );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 entry_path );
+
+		return( -1 );
+	}
+#endif
+	entry = &( key_path_cache->entries[ path_hash % (uint32_t) key_path_cache->number_of_entries ] );
+
+	if( entry->path != NULL )
+	{
+		memory_free(
+		 entry->path );
+	}
+	entry->base_key_offset = base_key_offset;
+	entry->path_hash       = path_hash;
+	entry->path            = entry_path;
+	entry->path_length     = path_length;
+	entry->key_offset      = key_offset;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the key path index data
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_cache_get_index_data_size(
+     libregf_key_path_cache_t *key_path_cache,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libregf_key_path_cache_entry_t *entry = NULL;
+	static char *function                 = "libregf_key_path_cache_get_index_data_size";
+	size_t safe_data_size                 = 0;
+	int entry_index                       = 0;
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_data_size = sizeof( regf_key_path_index_header_t );
+
+	for( entry_index = 0;
+	     entry_index < key_path_cache->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( key_path_cache->entries[ entry_index ] );
+
+		if( entry->path != NULL )
+		{
+			safe_data_size += sizeof( regf_key_path_index_entry_t ) + ( 4 * entry->path_length );
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the key path index data
+ * The index is bound to the file the file header was read from
+ * Entries that do not fit in the data, for example because they were added after
+ * the data size was determined, are not written
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_cache_write_index_data(
+     libregf_key_path_cache_t *key_path_cache,
+     libregf_file_header_t *file_header,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libregf_key_path_cache_entry_t *entry = NULL;
+	static char *function                 = "libregf_key_path_cache_write_index_data";
+	size_t data_offset                    = 0;
+	size_t entry_data_size                = 0;
+	size_t path_index                     = 0;
+	uint32_t number_of_index_entries      = 0;
+	int entry_index                       = 0;
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( regf_key_path_index_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	data_offset = sizeof( regf_key_path_index_header_t );
+
+	for( entry_index = 0;
+	     entry_index < key_path_cache->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( key_path_cache->entries[ entry_index ] );
+
+		if( entry->path == NULL )
+		{
+			continue;
+		}
+		entry_data_size = sizeof( regf_key_path_index_entry_t ) + ( 4 * entry->path_length );
+
+		if( entry_data_size > ( data_size - data_offset ) )
+		{
+			break;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_key_path_index_entry_t *) &( data[ data_offset ] ) )->base_key_offset,
+		 entry->base_key_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_key_path_index_entry_t *) &( data[ data_offset ] ) )->key_offset,
+		 entry->key_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_key_path_index_entry_t *) &( data[ data_offset ] ) )->path_length,
+		 (uint32_t) entry->path_length );
+
+		data_offset += sizeof( regf_key_path_index_entry_t );
+
+		for( path_index = 0;
+		     path_index < entry->path_length;
+		     path_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 entry->path[ path_index ] );
+
+			data_offset += 4;
+		}
+		number_of_index_entries++;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_copy(
+	     ( (regf_key_path_index_header_t *) data )->signature,
+	     regf_key_path_index_signature,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->format_version,
+	 LIBREGF_KEY_PATH_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->primary_sequence_number,
+	 file_header->primary_sequence_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->secondary_sequence_number,
+	 file_header->secondary_sequence_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->hive_bins_size,
+	 file_header->hive_bins_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->checksum,
+	 file_header->checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->number_of_entries,
+	 number_of_index_entries );
+
+	return( 1 );
+}
+
+/* Reads the key path index data
+ * The index is bound to the file the file header was read from
+ * The entries of the index are added to the cache only if the entire index could be read
+ * Returns 1 if successful, 0 if the index was not created for the file of the file header or -1 on error
+ */
+int libregf_key_path_cache_read_index_data(
+     libregf_key_path_cache_t *key_path_cache,
+     libregf_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libregf_key_path_cache_entry_t *entry          = NULL;
+	libregf_key_path_cache_entry_t *index_entry    = NULL;
+	libregf_key_path_cache_t *index_key_path_cache = NULL;
+	libuna_unicode_character_t *path               = NULL;
+	static char *function                          = "libregf_key_path_cache_read_index_data";
+	size_t data_offset                             = 0;
+	size_t path_index                              = 0;
+	uint32_t base_key_offset                       = 0;
+	uint32_t format_version                        = 0;
+	uint32_t key_offset                            = 0;
+	uint32_t number_of_index_entries               = 0;
+	uint32_t path_hash                             = 0;
+	uint32_t path_length                           = 0;
+	uint32_t value_32bit                           = 0;
+	uint32_t index_entry_index                     = 0;
+	int entry_index                                = 0;
+
+	if( key_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( regf_key_path_index_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (regf_key_path_index_header_t *) data )->signature,
+	     regf_key_path_index_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid key path index signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->format_version,
+	 format_version );
+
+	if( format_version != LIBREGF_KEY_PATH_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key path index format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	/* An index of another file or of a previous state of the file is ignored
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->primary_sequence_number,
+	 value_32bit );
+
+	if( value_32bit != file_header->primary_sequence_number )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->secondary_sequence_number,
+	 value_32bit );
+
+	if( value_32bit != file_header->secondary_sequence_number )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->hive_bins_size,
+	 value_32bit );
+
+	if( value_32bit != file_header->hive_bins_size )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->checksum,
+	 value_32bit );
+
+	if( value_32bit != file_header->checksum )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_key_path_index_header_t *) data )->number_of_entries,
+	 number_of_index_entries );
+
+	/* The index is read into a separate cache so that a truncated or corrupted index
+	 * does not leave part of its entries in the cache
+	 */
+	if( libregf_key_path_cache_initialize(
+	     &index_key_path_cache,
+	     key_path_cache->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index key path cache.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = sizeof( regf_key_path_index_header_t );
+
+	for( index_entry_index = 0;
+	     index_entry_index < number_of_index_entries;
+	     index_entry_index++ )
+	{
+		if( sizeof( regf_key_path_index_entry_t ) > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key path index entry: %" PRIu32 " data offset value out of bounds.",
+			 function,
+			 index_entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_key_path_index_entry_t *) &( data[ data_offset ] ) )->base_key_offset,
+		 base_key_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_key_path_index_entry_t *) &( data[ data_offset ] ) )->key_offset,
+		 key_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_key_path_index_entry_t *) &( data[ data_offset ] ) )->path_length,
+		 path_length );
+
+		data_offset += sizeof( regf_key_path_index_entry_t );
+
+		if( ( base_key_offset >= file_header->hive_bins_size )
+		 || ( key_offset >= file_header->hive_bins_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key path index entry: %" PRIu32 " key offset value out of bounds.",
+			 function,
+			 index_entry_index );
+
+			goto on_error;
+		}
+		if( ( path_length == 0 )
+		 || ( (size_t) path_length > ( ( data_size - data_offset ) / 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key path index entry: %" PRIu32 " path length value out of bounds.",
+			 function,
+			 index_entry_index );
+
+			goto on_error;
+		}
+		path = (libuna_unicode_character_t *) memory_allocate(
+		                                       sizeof( libuna_unicode_character_t ) * path_length );
+
+		if( path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create path.",
+			 function );
+
+			goto on_error;
+		}
+		/* The path hash is calculated in the same way as by the key tree path lookup
+		 */
+		path_hash = base_key_offset;
+
+		for( path_index = 0;
+		     path_index < (size_t) path_length;
+		     path_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 path[ path_index ] );
+
+			data_offset += 4;
+
+			path_hash *= 37;
+			path_hash += (uint32_t) path[ path_index ];
+		}
+		if( libregf_key_path_cache_set_key_offset(
+		     index_key_path_cache,
+		     base_key_offset,
+		     path,
+		     (size_t) path_length,
+		     path_hash,
+		     key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key offset of key path index entry: %" PRIu32 ".",
+			 function,
+			 index_entry_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 path );
+
+		path = NULL;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Both caches have the same number of entries, hence an index entry
+	 * is stored at the same entry index as it would be in the cache
+	 */
+	for( entry_index = 0;
+	     entry_index < key_path_cache->number_of_entries;
+	     entry_index++ )
+	{
+		index_entry = &( index_key_path_cache->entries[ entry_index ] );
+
+		if( index_entry->path == NULL )
+		{
+			continue;
+		}
+		entry = &( key_path_cache->entries[ entry_index ] );
+
+		if( entry->path != NULL )
+		{
+			memory_free(
+			 entry->path );
+		}
+		entry->base_key_offset = index_entry->base_key_offset;
+		entry->path_hash       = index_entry->path_hash;
+		entry->path            = index_entry->path;
+		entry->path_length     = index_entry->path_length;
+		entry->key_offset      = index_entry->key_offset;
+
+		index_entry->path = NULL;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libregf_key_path_cache_free(
+	     &index_key_path_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index key path cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( index_key_path_cache != NULL )
+	{
+		libregf_key_path_cache_free(
+		 &index_key_path_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Key path cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_KEY_PATH_CACHE_H )
+#define _LIBREGF_KEY_PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_file_header.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const char *regf_key_path_index_signature;
+
+typedef struct libregf_key_path_cache_entry libregf_key_path_cache_entry_t;
+
+struct libregf_key_path_cache_entry
+{
+	/* The offset of the key the path is relative to
+	 */
+	uint32_t base_key_offset;
+
+	/* The path hash
+	 */
+	uint32_t path_hash;
+
+	/* The upper case path
+	 */
+	libuna_unicode_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The offset of the key the path resolves to
+	 */
+	uint32_t key_offset;
+};
+
+typedef struct libregf_key_path_cache libregf_key_path_cache_t;
+
+struct libregf_key_path_cache
+{
+	/* The entries
+	 */
+	libregf_key_path_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libregf_key_path_cache_initialize(
+     libregf_key_path_cache_t **key_path_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libregf_key_path_cache_free(
+     libregf_key_path_cache_t **key_path_cache,
+     libcerror_error_t **error );
+
+int libregf_key_path_cache_get_key_offset(
+     libregf_key_path_cache_t *key_path_cache,
+     uint32_t base_key_offset,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
+int libregf_key_path_cache_set_key_offset(
+     libregf_key_path_cache_t *key_path_cache,
+     uint32_t base_key_offset,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     uint32_t key_offset,
+     libcerror_error_t **error );
+
+int libregf_key_path_cache_get_index_data_size(
+     libregf_key_path_cache_t *key_path_cache,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libregf_key_path_cache_write_index_data(
+     libregf_key_path_cache_t *key_path_cache,
+     libregf_file_header_t *file_header,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libregf_key_path_cache_read_index_data(
+     libregf_key_path_cache_t *key_path_cache,
+     libregf_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_KEY_PATH_CACHE_H ) */
+
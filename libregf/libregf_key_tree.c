@@ -20,6 +20,8 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_WCTYPE_H )
@@ -27,263 +29,2527 @@
 #endif
 
 #include "libregf_definitions.h"
+#include "libregf_hive_bin_cell.h"
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
 #include "libregf_key.h"
 #include "libregf_key_descriptor.h"
 #include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_key_path_cache.h"
 #include "libregf_key_tree.h"
 #include "libregf_libbfio.h"
+#include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcnotify.h"
 #include "libregf_libuna.h"
 
+#include "regf_cell_values.h"
+
 /* Retrieves the key for the specific UTF-8 encoded path
  * The path separator is the \ character
  * Creates a new key
+ * If a key path cache is provided the longest previously resolved prefix
+ * of the path is looked up and only the remaining segments are resolved
  * Returns 1 if successful, 0 if no such key or -1 on error
  */
-int libregf_key_tree_get_sub_key_by_utf8_path(
+int libregf_key_tree_get_sub_key_by_utf8_path(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     libregf_key_path_cache_t *key_path_cache,
+     uint32_t key_offset,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libregf_key_t **sub_key,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_key_item_t *sub_key_item             = NULL;
+	libuna_unicode_character_t *upper_case_path  = NULL;
+	uint8_t *utf8_string_segment                 = NULL;
+	static char *function                        = "libregf_key_tree_get_sub_key_by_utf8_path";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t path_length                           = 0;
+	size_t upper_case_path_length                = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_segment_length            = 0;
+	size_t upper_case_path_string_index          = 0;
+	uint32_t cached_key_offset                   = 0;
+	uint32_t name_hash                           = 0;
+	uint32_t path_hash                           = 0;
+	uint32_t sub_key_offset                      = 0;
+	uint32_t upper_case_path_hash                = 0;
+	int result                                   = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: sub key already set.",
+		 function );
+
+		return( -1 );
+	}
+	sub_key_offset = key_offset;
+
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBREGF_SEPARATOR )
+		{
+			utf8_string_index++;
+		}
+	}
+	if( ( key_path_cache != NULL )
+	 && ( utf8_string_index < utf8_string_length ) )
+	{
+		if( ( utf8_string_length - utf8_string_index ) > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string length value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		/* The number of Unicode characters cannot exceed the number of UTF-8 code units
+		 */
+		upper_case_path = (libuna_unicode_character_t *) memory_allocate(
+		                                                  sizeof( libuna_unicode_character_t ) * ( utf8_string_length - utf8_string_index ) );
+
+		if( upper_case_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create upper case path.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the longest prefix of the path that was resolved before
+		 * The separator is stored as LIBREGF_SEPARATOR in the upper case path
+		 */
+		upper_case_path_string_index = utf8_string_index;
+		upper_case_path_hash         = key_offset;
+		path_hash                    = key_offset;
+
+		while( upper_case_path_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &upper_case_path_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) LIBREGF_SEPARATOR;
+			}
+			else
+			{
+				unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 && ( upper_case_path_length > 0 ) )
+			{
+				result = libregf_key_path_cache_get_key_offset(
+				          key_path_cache,
+				          key_offset,
+				          upper_case_path,
+				          upper_case_path_length,
+				          upper_case_path_hash,
+				          &cached_key_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key offset from key path cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					utf8_string_index = upper_case_path_string_index;
+					path_length       = upper_case_path_length;
+					path_hash         = upper_case_path_hash;
+					sub_key_offset    = cached_key_offset;
+				}
+			}
+			upper_case_path[ upper_case_path_length++ ] = unicode_character;
+
+			upper_case_path_hash *= 37;
+			upper_case_path_hash += (uint32_t) unicode_character;
+
+			if( ( unicode_character != (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 && ( upper_case_path_string_index >= utf8_string_length ) )
+			{
+				result = libregf_key_path_cache_get_key_offset(
+				          key_path_cache,
+				          key_offset,
+				          upper_case_path,
+				          upper_case_path_length,
+				          upper_case_path_hash,
+				          &cached_key_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key offset from key path cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					utf8_string_index = upper_case_path_string_index;
+					path_length       = upper_case_path_length;
+					path_hash         = upper_case_path_hash;
+					sub_key_offset    = cached_key_offset;
+				}
+			}
+		}
+		result = 0;
+	}
+	/* If the string is empty return the current key
+	 */
+	if( utf8_string_length == utf8_string_index )
+	{
+		result = 1;
+	}
+	else while( utf8_string_index < utf8_string_length )
+	{
+		utf8_string_segment        = (uint8_t *) &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_length = utf8_string_index;
+		name_hash                  = 0;
+
+		if( ( upper_case_path != NULL )
+		 && ( path_length > 0 ) )
+		{
+			/* Add the separator preceding the segment
+			 */
+			path_hash *= 37;
+			path_hash += (uint32_t) upper_case_path[ path_length++ ];
+		}
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf8_string_segment_length += 1;
+
+				break;
+			}
+			name_hash *= 37;
+			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+
+			if( upper_case_path != NULL )
+			{
+				path_hash *= 37;
+				path_hash += (uint32_t) upper_case_path[ path_length++ ];
+			}
+		}
+		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+
+		if( utf8_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+/* TODO: instead of key item directory read key descriptors ? */
+			if( key_item_cache != NULL )
+			{
+				if( libregf_key_item_cache_get_key_item(
+				     key_item_cache,
+				     file_io_handle,
+				     hive_bins_list,
+				     sub_key_offset,
+				     name_hash,
+				     &sub_key_item,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( libregf_key_item_initialize(
+				     &sub_key_item,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create sub key item.",
+					 function );
+
+					goto on_error;
+				}
+				if( libregf_key_item_read(
+				     sub_key_item,
+				     file_io_handle,
+				     hive_bins_list,
+				     sub_key_offset,
+				     name_hash,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					goto on_error;
+				}
+			}
+			result = libregf_key_item_get_sub_key_descriptor_by_utf8_name(
+			          sub_key_item,
+			          file_io_handle,
+			          hive_bins_list,
+			          name_hash,
+				  utf8_string_segment,
+				  utf8_string_segment_length,
+			          &sub_key_descriptor,
+			          error );
+
+			if( result == 1 )
+			{
+				sub_key_offset = sub_key_descriptor->key_offset;
+
+				if( upper_case_path != NULL )
+				{
+					if( libregf_key_path_cache_set_key_offset(
+					     key_path_cache,
+					     key_offset,
+					     upper_case_path,
+					     path_length,
+					     path_hash,
+					     sub_key_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set key offset in key path cache.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			if( libregf_key_item_release_reference(
+			     &sub_key_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release sub key item.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key values by name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libregf_key_initialize(
+		     sub_key,
+		     io_handle,
+		     file_io_handle,
+		     sub_key_offset,
+		     hive_bins_list,
+		     key_item_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( upper_case_path != NULL )
+	{
+		memory_free(
+		 upper_case_path );
+	}
+	return( result );
+
+on_error:
+	if( sub_key_item != NULL )
+	{
+		libregf_key_item_release_reference(
+		 &sub_key_item,
+		 NULL );
+	}
+	if( upper_case_path != NULL )
+	{
+		memory_free(
+		 upper_case_path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the offset of the sub key for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int libregf_key_tree_get_sub_key_offset_by_utf8_name(
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_key_item_t *key_item                 = NULL;
+	static char *function                        = "libregf_key_tree_get_sub_key_offset_by_utf8_name";
+	int result                                   = 0;
+
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_get_key_item(
+		     key_item_cache,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     name_hash,
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libregf_key_item_initialize(
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
+	}
+	result = libregf_key_item_get_sub_key_descriptor_by_utf8_name(
+	          key_item,
+	          file_io_handle,
+	          hive_bins_list,
+	          name_hash,
+	          utf8_string,
+	          utf8_string_length,
+	          &sub_key_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key descriptor by name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*sub_key_offset = sub_key_descriptor->key_offset;
+	}
+	if( libregf_key_item_release_reference(
+	     &key_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release key item.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( key_item != NULL )
+	{
+		libregf_key_item_release_reference(
+		 &key_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two UTF-8 encoded paths
+ * The comparison is case insensitive and the separator sorts before any other character,
+ * so that paths with the same leading segments are adjacent when sorted
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libregf_key_tree_utf8_path_compare(
+     libregf_key_tree_utf8_path_t *first_path,
+     libregf_key_tree_utf8_path_t *second_path,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libregf_key_tree_utf8_path_compare";
+	libuna_unicode_character_t first_unicode_character  = 0;
+	libuna_unicode_character_t second_unicode_character = 0;
+	size_t first_utf8_string_index                      = 0;
+	size_t second_utf8_string_index                     = 0;
+
+	if( first_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first path.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second path.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( first_utf8_string_index < first_path->utf8_string_length )
+	    && ( second_utf8_string_index < second_path->utf8_string_length ) )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &first_unicode_character,
+		     first_path->utf8_string,
+		     first_path->utf8_string_length,
+		     &first_utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy first UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_from_utf8(
+		     &second_unicode_character,
+		     second_path->utf8_string,
+		     second_path->utf8_string_length,
+		     &second_utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy second UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( first_unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+		{
+			first_unicode_character = 0;
+		}
+		else
+		{
+			first_unicode_character = (libuna_unicode_character_t) towupper( (wint_t) first_unicode_character );
+		}
+		if( second_unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+		{
+			second_unicode_character = 0;
+		}
+		else
+		{
+			second_unicode_character = (libuna_unicode_character_t) towupper( (wint_t) second_unicode_character );
+		}
+		if( first_unicode_character < second_unicode_character )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( first_unicode_character > second_unicode_character )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	if( first_utf8_string_index < first_path->utf8_string_length )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	else if( second_utf8_string_index < second_path->utf8_string_length )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Retrieves the keys for specific UTF-8 encoded paths
+ * The path separator is the \ character
+ * The paths are resolved in sorted order, where a path reuses the keys of the leading segments
+ * it shares with the previous path, hence every shared intermediate key is read only once
+ * Creates a new key for every path that was found and sets the key of a path that was not found to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_tree_get_sub_keys_by_utf8_paths(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     const uint8_t **utf8_strings,
+     size_t *utf8_string_lengths,
+     int number_of_paths,
+     libregf_key_t **sub_keys,
+     libcerror_error_t **error )
+{
+	libregf_key_tree_utf8_path_t previous_segment;
+	libregf_key_tree_utf8_path_t segment;
+
+	libcdata_array_t *sorted_paths_array          = NULL;
+	libregf_key_tree_utf8_path_t *path            = NULL;
+	libregf_key_tree_utf8_path_t *paths           = NULL;
+	const uint8_t **segment_strings               = NULL;
+	size_t *segment_string_lengths                = NULL;
+	uint32_t *segment_key_offsets                 = NULL;
+	const uint8_t *utf8_string_segment            = NULL;
+	static char *function                         = "libregf_key_tree_get_sub_keys_by_utf8_paths";
+	libuna_unicode_character_t unicode_character  = 0;
+	size_t maximum_utf8_string_length             = 0;
+	size_t utf8_string_index                      = 0;
+	size_t utf8_string_segment_length             = 0;
+	uint32_t name_hash                            = 0;
+	uint32_t sub_key_offset                       = 0;
+	int entry_index                               = 0;
+	int number_of_resolved_segments               = 0;
+	int path_index                                = 0;
+	int reuse_segments                            = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths <= 0 )
+	 || ( (size_t) number_of_paths > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libregf_key_tree_utf8_path_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( utf8_strings[ path_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( utf8_string_lengths[ path_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string: %d length value exceeds maximum.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( sub_keys[ path_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: sub key: %d already set.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( utf8_string_lengths[ path_index ] > maximum_utf8_string_length )
+		{
+			maximum_utf8_string_length = utf8_string_lengths[ path_index ];
+		}
+	}
+	/* A path cannot contain more segments than it contains characters
+	 */
+	if( maximum_utf8_string_length > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	paths = (libregf_key_tree_utf8_path_t *) memory_allocate(
+	                                          sizeof( libregf_key_tree_utf8_path_t ) * number_of_paths );
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create paths.",
+		 function );
+
+		goto on_error;
+	}
+	segment_strings = (const uint8_t **) memory_allocate(
+	                                      sizeof( const uint8_t * ) * ( maximum_utf8_string_length + 1 ) );
+
+	if( segment_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment strings.",
+		 function );
+
+		goto on_error;
+	}
+	segment_string_lengths = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * ( maximum_utf8_string_length + 1 ) );
+
+	if( segment_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment string lengths.",
+		 function );
+
+		goto on_error;
+	}
+	/* The segment key offsets contain the key offset of the base key
+	 * followed by the key offsets of the resolved segments
+	 */
+	segment_key_offsets = (uint32_t *) memory_allocate(
+	                                    sizeof( uint32_t ) * ( maximum_utf8_string_length + 2 ) );
+
+	if( segment_key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	segment_key_offsets[ 0 ] = key_offset;
+
+	if( libcdata_array_initialize(
+	     &sorted_paths_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sorted paths array.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		path = &( paths[ path_index ] );
+
+		path->utf8_string        = utf8_strings[ path_index ];
+		path->utf8_string_length = utf8_string_lengths[ path_index ];
+		path->path_index         = path_index;
+
+		/* Ignore a leading separator
+		 */
+		if( ( path->utf8_string_length > 0 )
+		 && ( path->utf8_string[ 0 ] == (uint8_t) LIBREGF_SEPARATOR ) )
+		{
+			path->utf8_string        += 1;
+			path->utf8_string_length -= 1;
+		}
+		if( libcdata_array_insert_entry(
+		     sorted_paths_array,
+		     &entry_index,
+		     (intptr_t *) path,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libregf_key_tree_utf8_path_compare,
+		     LIBCDATA_INSERT_FLAG_NON_UNIQUE_ENTRIES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert path: %d in sorted paths array.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_paths;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sorted_paths_array,
+		     entry_index,
+		     (intptr_t **) &path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path: %d from sorted paths array.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing path: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		utf8_string_index = 0;
+		segment_index     = 0;
+		reuse_segments    = 1;
+		result            = 1;
+
+		while( utf8_string_index < path->utf8_string_length )
+		{
+			utf8_string_segment        = &( path->utf8_string[ utf8_string_index ] );
+			utf8_string_segment_length = utf8_string_index;
+			name_hash                  = 0;
+
+			while( utf8_string_index < path->utf8_string_length )
+			{
+				if( libuna_unicode_character_copy_from_utf8(
+				     &unicode_character,
+				     path->utf8_string,
+				     path->utf8_string_length,
+				     &utf8_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 string to Unicode character.",
+					 function );
+
+					goto on_error;
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					utf8_string_segment_length += 1;
+
+					break;
+				}
+				name_hash *= 37;
+				name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+			}
+			utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+
+			if( utf8_string_segment_length == 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			/* Reuse the key of the segment resolved for the previous path
+			 * as long as the leading segments of both paths are the same
+			 */
+			if( ( reuse_segments != 0 )
+			 && ( segment_index < number_of_resolved_segments ) )
+			{
+				previous_segment.utf8_string        = segment_strings[ segment_index ];
+				previous_segment.utf8_string_length = segment_string_lengths[ segment_index ];
+				segment.utf8_string                 = utf8_string_segment;
+				segment.utf8_string_length          = utf8_string_segment_length;
+
+				result = libregf_key_tree_utf8_path_compare(
+				          &previous_segment,
+				          &segment,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare segment: %d.",
+					 function,
+					 segment_index );
+
+					goto on_error;
+				}
+				else if( result == LIBCDATA_COMPARE_EQUAL )
+				{
+					segment_index++;
+
+					result = 1;
+
+					continue;
+				}
+				reuse_segments = 0;
+			}
+			else
+			{
+				reuse_segments = 0;
+			}
+			/* The resolved segments of the previous path beyond this point no longer apply
+			 */
+			number_of_resolved_segments = segment_index;
+
+			result = libregf_key_tree_get_sub_key_offset_by_utf8_name(
+			          file_io_handle,
+			          hive_bins_list,
+			          key_item_cache,
+			          segment_key_offsets[ segment_index ],
+			          name_hash,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          &sub_key_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key offset by name.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			segment_strings[ segment_index ]        = utf8_string_segment;
+			segment_string_lengths[ segment_index ] = utf8_string_segment_length;
+
+			segment_index++;
+
+			segment_key_offsets[ segment_index ] = sub_key_offset;
+			number_of_resolved_segments          = segment_index;
+		}
+		if( result != 0 )
+		{
+			if( libregf_key_initialize(
+			     &( sub_keys[ path->path_index ] ),
+			     io_handle,
+			     file_io_handle,
+			     segment_key_offsets[ segment_index ],
+			     hive_bins_list,
+			     key_item_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub key: %d.",
+				 function,
+				 path->path_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libcdata_array_free(
+	     &sorted_paths_array,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sorted paths array.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 segment_key_offsets );
+
+	memory_free(
+	 segment_string_lengths );
+
+	memory_free(
+	 segment_strings );
+
+	memory_free(
+	 paths );
+
+	return( 1 );
+
+on_error:
+	if( sub_keys != NULL )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			if( sub_keys[ path_index ] != NULL )
+			{
+				libregf_key_free(
+				 &( sub_keys[ path_index ] ),
+				 NULL );
+			}
+		}
+	}
+	if( sorted_paths_array != NULL )
+	{
+		libcdata_array_free(
+		 &sorted_paths_array,
+		 NULL,
+		 NULL );
+	}
+	if( segment_key_offsets != NULL )
+	{
+		memory_free(
+		 segment_key_offsets );
+	}
+	if( segment_string_lengths != NULL )
+	{
+		memory_free(
+		 segment_string_lengths );
+	}
+	if( segment_strings != NULL )
+	{
+		memory_free(
+		 segment_strings );
+	}
+	if( paths != NULL )
+	{
+		memory_free(
+		 paths );
+	}
+	return( -1 );
+}
+
+/* Reads the element of a sub keys list for a walk
+ * Returns 1 if successful, 0 if the element index is beyond the number of elements or -1 on error
+ */
+int libregf_key_tree_walk_read_sub_keys_list_element(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t sub_keys_list_offset,
+     uint16_t element_index,
+     uint32_t *element_offset,
+     uint8_t *is_index_list,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t hive_bin_cell;
+
+	static char *function       = "libregf_key_tree_walk_read_sub_keys_list_element";
+	size_t data_offset          = 0;
+	uint16_t number_of_elements = 0;
+	uint8_t element_data_size   = 0;
+	int result                  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_index_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is index list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bins_list_get_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     sub_keys_list_offset,
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_keys_list_offset,
+		 sub_keys_list_offset );
+
+		goto on_error;
+	}
+	if( ( io_handle->major_version == 1 )
+	 && ( io_handle->minor_version <= 1 ) )
+	{
+		data_offset += 4;
+	}
+	if( ( (size_t) hive_bin_cell.size < data_offset )
+	 || ( sizeof( regf_sub_key_list_t ) > ( (size_t) hive_bin_cell.size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hive bin cell size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Check if the signature matches that of a sub key list: "lf", "lh", "li" or "ri"
+	 */
+	if( ( hive_bin_cell.data[ data_offset ] == (uint8_t) 'r' )
+	 && ( hive_bin_cell.data[ data_offset + 1 ] == (uint8_t) 'i' ) )
+	{
+		element_data_size = 4;
+		*is_index_list    = 1;
+	}
+	else if( ( hive_bin_cell.data[ data_offset ] == (uint8_t) 'l' )
+	      && ( hive_bin_cell.data[ data_offset + 1 ] == (uint8_t) 'i' ) )
+	{
+		element_data_size = 4;
+		*is_index_list    = 0;
+	}
+	else if( ( hive_bin_cell.data[ data_offset ] == (uint8_t) 'l' )
+	      && ( ( hive_bin_cell.data[ data_offset + 1 ] == (uint8_t) 'f' )
+	       ||  ( hive_bin_cell.data[ data_offset + 1 ] == (uint8_t) 'h' ) ) )
+	{
+		element_data_size = 8;
+		*is_index_list    = 0;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sub key list signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (regf_sub_key_list_t *) &( hive_bin_cell.data[ data_offset ] ) )->number_of_elements,
+	 number_of_elements );
+
+	data_offset += sizeof( regf_sub_key_list_t );
+
+	if( (size_t) number_of_elements > ( ( (size_t) hive_bin_cell.size - data_offset ) / element_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of elements value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( element_index < number_of_elements )
+	{
+		data_offset += (size_t) element_index * element_data_size;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( hive_bin_cell.data[ data_offset ] ),
+		 *element_offset );
+
+		result = 1;
+	}
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the offset of the next sub key of a walk frame
+ * Returns 1 if successful, 0 if there are no more sub keys or -1 on error
+ */
+int libregf_key_tree_walk_get_next_sub_key_offset(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_tree_walk_frame_t *walk_frame,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libregf_key_tree_walk_get_next_sub_key_offset";
+	uint32_t element_offset = 0;
+	uint8_t is_index_list   = 0;
+	int result              = 0;
+
+	if( walk_frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walk frame.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The list cells are retrieved again for every sub key, since reading
+	 * the sub keys can evict the hive bin that contains the list from the cache
+	 */
+	while( walk_frame->element_index < UINT16_MAX )
+	{
+		result = libregf_key_tree_walk_read_sub_keys_list_element(
+		          io_handle,
+		          file_io_handle,
+		          hive_bins_list,
+		          walk_frame->sub_keys_list_offset,
+		          walk_frame->element_index,
+		          &element_offset,
+		          &is_index_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub keys list element: %" PRIu16 ".",
+			 function,
+			 walk_frame->element_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( is_index_list == 0 )
+		{
+			walk_frame->element_index += 1;
+
+			*sub_key_offset = element_offset;
+
+			return( 1 );
+		}
+		/* The elements of an index list refer to sub keys lists
+		 */
+		result = libregf_key_tree_walk_read_sub_keys_list_element(
+		          io_handle,
+		          file_io_handle,
+		          hive_bins_list,
+		          element_offset,
+		          walk_frame->sub_element_index,
+		          sub_key_offset,
+		          &is_index_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub keys list: %" PRIu16 " element: %" PRIu16 ".",
+			 function,
+			 walk_frame->element_index,
+			 walk_frame->sub_element_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			walk_frame->element_index    += 1;
+			walk_frame->sub_element_index = 0;
+
+			continue;
+		}
+		if( is_index_list != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported nested index sub keys list.",
+			 function );
+
+			return( -1 );
+		}
+		walk_frame->sub_element_index += 1;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads a named key for a walk
+ * Sets the name and the values of the walk key that are stored in the named key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_tree_walk_read_named_key(
+     libregf_hive_bin_cell_t *named_key_cell,
+     size_t version_data_offset,
+     libregf_walk_key_t *walk_key,
+     uint32_t *values_list_offset,
+     uint32_t *sub_keys_list_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *key_data = NULL;
+	static char *function   = "libregf_key_tree_walk_read_named_key";
+	size_t data_offset      = 0;
+	uint16_t flags          = 0;
+	uint16_t name_size      = 0;
+
+	if( named_key_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid named key cell.",
+		 function );
+
+		return( -1 );
+	}
+	if( walk_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walk key.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_list_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values list offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_keys_list_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys list offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = version_data_offset;
+
+	if( ( (size_t) named_key_cell->size < data_offset )
+	 || ( sizeof( regf_named_key_t ) > ( (size_t) named_key_cell->size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid named key cell size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	key_data = &( named_key_cell->data[ data_offset ] );
+
+	/* Check if the signature matches that of a named key: "nk"
+	 */
+	if( ( key_data[ 0 ] != (uint8_t) 'n' )
+	 || ( key_data[ 1 ] != (uint8_t) 'k' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported named key signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (regf_named_key_t *) key_data )->flags,
+	 flags );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (regf_named_key_t *) key_data )->key_name_size,
+	 name_size );
+
+	data_offset += sizeof( regf_named_key_t );
+
+	if( (size_t) name_size > ( (size_t) named_key_cell->size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid named key name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	walk_key->name          = &( named_key_cell->data[ data_offset ] );
+	walk_key->name_size     = (size_t) name_size;
+	walk_key->name_is_ascii = (uint8_t) ( ( flags & LIBREGF_NAMED_KEY_FLAG_NAME_IS_ASCII ) != 0 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (regf_named_key_t *) key_data )->last_written_time,
+	 walk_key->last_written_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_named_key_t *) key_data )->number_of_sub_keys,
+	 walk_key->number_of_sub_keys );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_named_key_t *) key_data )->number_of_values,
+	 walk_key->number_of_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_named_key_t *) key_data )->sub_keys_list_offset,
+	 *sub_keys_list_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_named_key_t *) key_data )->values_list_offset,
+	 *values_list_offset );
+
+	return( 1 );
+}
+
+/* Reads a value key for a walk
+ * Sets the name and the values of the walk value that are stored in the value key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_tree_walk_read_value_key(
+     libregf_hive_bin_cell_t *value_key_cell,
+     size_t version_data_offset,
+     libregf_walk_value_t *walk_value,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "libregf_key_tree_walk_read_value_key";
+	size_t data_offset        = 0;
+	uint16_t flags            = 0;
+	uint16_t name_size        = 0;
+
+	if( value_key_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value key cell.",
+		 function );
+
+		return( -1 );
+	}
+	if( walk_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walk value.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = version_data_offset;
+
+	if( ( (size_t) value_key_cell->size < data_offset )
+	 || ( sizeof( regf_value_key_t ) > ( (size_t) value_key_cell->size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value key cell size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_data = &( value_key_cell->data[ data_offset ] );
+
+	/* Check if the signature matches that of a value key: "vk"
+	 */
+	if( ( value_data[ 0 ] != (uint8_t) 'v' )
+	 || ( value_data[ 1 ] != (uint8_t) 'k' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value key signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (regf_value_key_t *) value_data )->flags,
+	 flags );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (regf_value_key_t *) value_data )->value_name_size,
+	 name_size );
+
+	data_offset += sizeof( regf_value_key_t );
+
+	if( (size_t) name_size > ( (size_t) value_key_cell->size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value key name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	walk_value->name          = &( value_key_cell->data[ data_offset ] );
+	walk_value->name_size     = (size_t) name_size;
+	walk_value->name_is_ascii = (uint8_t) ( ( flags & LIBREGF_VALUE_KEY_FLAG_NAME_IS_ASCII ) != 0 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_value_key_t *) value_data )->value_type,
+	 walk_value->value_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_value_key_t *) value_data )->data_size,
+	 walk_value->data_size );
+
+	walk_value->data_size &= 0x7fffffffUL;
+
+	return( 1 );
+}
+
+/* Visits a key and its values for a walk
+ * The names of the walk key and walk values reference the cell data
+ * and are only valid for the duration of the callback
+ * A corrupted named key is skipped together with its sub keys, a corrupted values list
+ * or value key is skipped, in both cases the file is marked as corrupted
+ * Returns 1 if the sub keys of the key should be walked, 0 if not or -1 on error
+ */
+int libregf_key_tree_walk_key(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t parent_key_offset,
+     int depth,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     uint32_t *sub_keys_list_offset,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t named_key_cell;
+	libregf_hive_bin_cell_t value_key_cell;
+	libregf_hive_bin_cell_t values_list_cell;
+	libregf_walk_key_t walk_key;
+	libregf_walk_value_t walk_value;
+
+	static char *function         = "libregf_key_tree_walk_key";
+	size_t version_data_offset    = 0;
+	uint32_t safe_sub_keys_offset = 0;
+	uint32_t value_index          = 0;
+	uint32_t value_key_offset     = 0;
+	uint32_t values_list_offset   = 0;
+	int callback_result           = 1;
+	int result                    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_keys_list_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys list offset.",
+		 function );
+
+		return( -1 );
+	}
+	named_key_cell.hive_bin   = NULL;
+	value_key_cell.hive_bin   = NULL;
+	values_list_cell.hive_bin = NULL;
+
+	if( ( io_handle->major_version == 1 )
+	 && ( io_handle->minor_version <= 1 ) )
+	{
+		version_data_offset = 4;
+	}
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          key_offset,
+	          &named_key_cell,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libregf_key_tree_walk_read_named_key(
+		          &named_key_cell,
+		          version_data_offset,
+		          &walk_key,
+		          &values_list_offset,
+		          &safe_sub_keys_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		/* A corrupted named key is skipped
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		if( libregf_io_handle_set_corrupted(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to mark file as corrupted.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_hive_bin_cell_free_data(
+		     &named_key_cell,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free named key cell data.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	walk_key.offset        = key_offset;
+	walk_key.parent_offset = parent_key_offset;
+	walk_key.depth         = depth;
+
+	if( key_callback != NULL )
+	{
+		callback_result = key_callback(
+		                   &walk_key,
+		                   user_data );
+
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: key callback failed for key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
+	}
+	if( libregf_hive_bin_cell_free_data(
+	     &named_key_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free named key cell data.",
+		 function );
+
+		goto on_error;
+	}
+	if( callback_result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( value_callback != NULL )
+	 && ( walk_key.number_of_values > 0 )
+	 && ( values_list_offset != 0xffffffffUL ) )
+	{
+		/* The values list cell data remains valid while the value keys are read
+		 * since the cell data is copied if the hive bin can be evicted from the cache
+		 */
+		result = libregf_hive_bins_list_get_cell_at_offset(
+		          hive_bins_list,
+		          file_io_handle,
+		          values_list_offset,
+		          &values_list_cell,
+		          error );
+
+		if( result == 1 )
+		{
+			if( ( (size_t) values_list_cell.size < version_data_offset )
+			 || ( (size_t) walk_key.number_of_values > ( ( (size_t) values_list_cell.size - version_data_offset ) / 4 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid values list cell size value too small to contain number of values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			/* A corrupted values list is skipped
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read values list at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+				 function,
+				 values_list_offset,
+				 values_list_offset );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( libregf_io_handle_set_corrupted(
+			     io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to mark file as corrupted.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			for( value_index = 0;
+			     value_index < walk_key.number_of_values;
+			     value_index++ )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( values_list_cell.data[ version_data_offset + ( (size_t) value_index * 4 ) ] ),
+				 value_key_offset );
+
+				result = libregf_hive_bins_list_get_cell_at_offset(
+				          hive_bins_list,
+				          file_io_handle,
+				          value_key_offset,
+				          &value_key_cell,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libregf_key_tree_walk_read_value_key(
+					          &value_key_cell,
+					          version_data_offset,
+					          &walk_value,
+					          error );
+				}
+				if( result != 1 )
+				{
+					/* A corrupted value key is skipped
+					 */
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: unable to read value key at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+						 function,
+						 value_key_offset,
+						 value_key_offset );
+
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+
+					if( libregf_io_handle_set_corrupted(
+					     io_handle,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to mark file as corrupted.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else
+				{
+					walk_value.offset     = value_key_offset;
+					walk_value.key_offset = key_offset;
+					walk_value.depth      = depth;
+
+					callback_result = value_callback(
+					                   &walk_value,
+					                   user_data );
+
+					if( callback_result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: value callback failed for value at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+						 function,
+						 value_key_offset,
+						 value_key_offset );
+
+						goto on_error;
+					}
+				}
+				if( libregf_hive_bin_cell_free_data(
+				     &value_key_cell,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free value key cell data.",
+					 function );
+
+					goto on_error;
+				}
+				if( callback_result == 0 )
+				{
+					break;
+				}
+			}
+		}
+		if( libregf_hive_bin_cell_free_data(
+		     &values_list_cell,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free values list cell data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( walk_key.number_of_sub_keys == 0 )
+	 || ( safe_sub_keys_offset == 0xffffffffUL ) )
+	{
+		return( 0 );
+	}
+	*sub_keys_list_offset = safe_sub_keys_offset;
+
+	return( 1 );
+
+on_error:
+	libregf_hive_bin_cell_free_data(
+	 &value_key_cell,
+	 NULL );
+
+	libregf_hive_bin_cell_free_data(
+	 &values_list_cell,
+	 NULL );
+
+	libregf_hive_bin_cell_free_data(
+	 &named_key_cell,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Walks the keys of a key tree depth first
+ * The key callback is called for every key and the value callback, if provided, for every value of the key
+ * A callback returns 1 to continue, 0 to skip the remaining values or the sub keys and values of a key or -1 to stop with an error
+ * The walk uses a fixed number of frames, hence no key or value objects are created
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_tree_walk(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libregf_key_tree_walk_frame_t walk_frames[ LIBREGF_MAXIMUM_SUB_KEY_RECURSION_DEPTH ];
+
+	libregf_key_tree_walk_frame_t *walk_frame = NULL;
+	static char *function                     = "libregf_key_tree_walk";
+	uint32_t sub_key_offset                   = 0;
+	uint32_t sub_keys_list_offset             = 0;
+	int number_of_walk_frames                 = 0;
+	int result                                = 0;
+
+	result = libregf_key_tree_walk_key(
+	          io_handle,
+	          file_io_handle,
+	          hive_bins_list,
+	          key_offset,
+	          0,
+	          0,
+	          key_callback,
+	          value_callback,
+	          user_data,
+	          &sub_keys_list_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to walk key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		walk_frames[ 0 ].key_offset           = key_offset;
+		walk_frames[ 0 ].sub_keys_list_offset = sub_keys_list_offset;
+		walk_frames[ 0 ].element_index        = 0;
+		walk_frames[ 0 ].sub_element_index    = 0;
+
+		number_of_walk_frames = 1;
+	}
+	while( number_of_walk_frames > 0 )
+	{
+		walk_frame = &( walk_frames[ number_of_walk_frames - 1 ] );
+
+		result = libregf_key_tree_walk_get_next_sub_key_offset(
+		          io_handle,
+		          file_io_handle,
+		          hive_bins_list,
+		          walk_frame,
+		          &sub_key_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next sub key offset of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 walk_frame->key_offset,
+			 walk_frame->key_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			number_of_walk_frames--;
+
+			continue;
+		}
+		result = libregf_key_tree_walk_key(
+		          io_handle,
+		          file_io_handle,
+		          hive_bins_list,
+		          sub_key_offset,
+		          walk_frame->key_offset,
+		          number_of_walk_frames,
+		          key_callback,
+		          value_callback,
+		          user_data,
+		          &sub_keys_list_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to walk key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 sub_key_offset,
+			 sub_key_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		/* A loop in the key tree would otherwise be walked indefinitely
+		 */
+		if( number_of_walk_frames >= LIBREGF_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid depth value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		walk_frame = &( walk_frames[ number_of_walk_frames ] );
+
+		walk_frame->key_offset           = sub_key_offset;
+		walk_frame->sub_keys_list_offset = sub_keys_list_offset;
+		walk_frame->element_index        = 0;
+		walk_frame->sub_element_index    = 0;
+
+		number_of_walk_frames++;
+	}
+	return( 1 );
+}
+
+/* Scans the keys of a key tree in the order of the named key cells in the file
+ * The key callback is called for every allocated named key and the value callback, if provided, for every value of the key
+ * A callback returns 1 to continue, 0 to skip the remaining values or the values of a key or -1 to stop with an error
+ * Cells that cannot be read or parsed are skipped and mark the file as corrupted
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_tree_scan(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
-     uint32_t key_offset,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libregf_key_t **sub_key,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
-	libregf_key_descriptor_t *sub_key_descriptor = NULL;
-	libregf_key_item_t *sub_key_item             = NULL;
-	uint8_t *utf8_string_segment                 = NULL;
-	static char *function                        = "libregf_key_tree_get_sub_key_by_utf8_path";
-	libuna_unicode_character_t unicode_character = 0;
-	size_t utf8_string_index                     = 0;
-	size_t utf8_string_segment_length            = 0;
-	uint32_t name_hash                           = 0;
-	uint32_t sub_key_offset                      = 0;
-	int result                                   = 0;
+	libregf_hive_bin_cell_t hive_bin_cell;
 
-	if( utf8_string == NULL )
+	static char *function         = "libregf_key_tree_scan";
+	size_t data_offset            = 0;
+	uint32_t named_key_offset     = 0;
+	uint32_t parent_key_offset    = 0;
+	uint32_t sub_keys_list_offset = 0;
+	uint8_t is_named_key          = 0;
+	int cell_index                = 0;
+	int hive_bin_index            = 0;
+	int number_of_hive_bins       = 0;
+	int result                    = 0;
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_key == NULL )
+	if( ( io_handle->major_version == 1 )
+	 && ( io_handle->minor_version <= 1 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub key.",
-		 function );
-
-		return( -1 );
+		data_offset = 4;
 	}
-	if( *sub_key != NULL )
+	if( libregf_hive_bins_list_get_number_of_hive_bins(
+	     hive_bins_list,
+	     &number_of_hive_bins,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: sub key already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of hive bins.",
 		 function );
 
 		return( -1 );
 	}
-	sub_key_offset = key_offset;
-
-	if( utf8_string_length > 0 )
+	for( hive_bin_index = 0;
+	     hive_bin_index < number_of_hive_bins;
+	     hive_bin_index++ )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBREGF_SEPARATOR )
+		for( cell_index = 0;
+		     cell_index < INT_MAX;
+		     cell_index++ )
 		{
-			utf8_string_index++;
-		}
-	}
-	/* If the string is empty return the current key
-	 */
-	if( utf8_string_length == utf8_string_index )
-	{
-		result = 1;
-	}
-	else while( utf8_string_index < utf8_string_length )
-	{
-		utf8_string_segment        = (uint8_t *) &( utf8_string[ utf8_string_index ] );
-		utf8_string_segment_length = utf8_string_index;
-		name_hash                  = 0;
+			result = libregf_hive_bins_list_get_cell_by_index(
+			          hive_bins_list,
+			          file_io_handle,
+			          hive_bin_index,
+			          cell_index,
+			          &hive_bin_cell,
+			          error );
 
-		while( utf8_string_index < utf8_string_length )
-		{
-			if( libuna_unicode_character_copy_from_utf8(
-			     &unicode_character,
-			     utf8_string,
-			     utf8_string_length,
-			     &utf8_string_index,
-			     error ) != 1 )
+			if( result == -1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-8 string to Unicode character.",
-				 function );
+				/* The remaining cells of a corrupted hive bin are skipped
+				 */
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to retrieve hive bin: %d cell: %d.\n",
+					 function,
+					 hive_bin_index,
+					 cell_index );
 
-				goto on_error;
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				if( libregf_io_handle_set_corrupted(
+				     io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to mark file as corrupted.",
+					 function );
+
+					return( -1 );
+				}
+				break;
 			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
-			 || ( unicode_character == 0 ) )
+			else if( result == 0 )
 			{
-				utf8_string_segment_length += 1;
-
 				break;
 			}
-			name_hash *= 37;
-			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
-		}
-		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+			named_key_offset = hive_bin_cell.offset;
+			is_named_key     = 0;
 
-		if( utf8_string_segment_length == 0 )
-		{
-			result = 0;
-		}
-		else
-		{
-/* TODO: instead of key item directory read key descriptors ? */
-			if( libregf_key_item_initialize(
-			     &sub_key_item,
+			/* Check if the signature matches that of a named key: "nk"
+			 */
+			if( ( ( hive_bin_cell.flags & LIBREGF_HIVE_BIN_CELL_FLAG_UNALLOCATED ) == 0 )
+			 && ( (size_t) hive_bin_cell.size >= data_offset )
+			 && ( sizeof( regf_named_key_t ) <= ( (size_t) hive_bin_cell.size - data_offset ) )
+			 && ( hive_bin_cell.data[ data_offset ] == (uint8_t) 'n' )
+			 && ( hive_bin_cell.data[ data_offset + 1 ] == (uint8_t) 'k' ) )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (regf_named_key_t *) &( hive_bin_cell.data[ data_offset ] ) )->parent_key_offset,
+				 parent_key_offset );
+
+				is_named_key = 1;
+			}
+			if( libregf_hive_bin_cell_free_data(
+			     &hive_bin_cell,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub key item.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin cell data.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( libregf_key_item_read(
-			     sub_key_item,
-			     file_io_handle,
-			     hive_bins_list,
-			     sub_key_offset,
-			     name_hash,
-			     error ) != 1 )
+			if( is_named_key == 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_key_offset,
-				 sub_key_offset );
-
-				goto on_error;
+				continue;
 			}
-			result = libregf_key_item_get_sub_key_descriptor_by_utf8_name(
-			          sub_key_item,
+			/* The values are visited through the values list of the named key,
+			 * since a value key does not contain the offset of the named key
+			 */
+			result = libregf_key_tree_walk_key(
+			          io_handle,
 			          file_io_handle,
 			          hive_bins_list,
-			          name_hash,
-				  utf8_string_segment,
-				  utf8_string_segment_length,
-			          &sub_key_descriptor,
+			          named_key_offset,
+			          parent_key_offset,
+			          -1,
+			          key_callback,
+			          value_callback,
+			          user_data,
+			          &sub_keys_list_offset,
 			          error );
 
-			if( result == 1 )
-			{
-				sub_key_offset = sub_key_descriptor->key_offset;
-			}
-			if( libregf_key_item_free(
-			     &sub_key_item,
-			     error ) != 1 )
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free sub key item.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 named_key_offset,
+				 named_key_offset );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key values by name.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-	}
-	if( result != 0 )
-	{
-		if( libregf_key_initialize(
-		     sub_key,
-		     io_handle,
-		     file_io_handle,
-		     sub_key_offset,
-		     hive_bins_list,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub key.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	return( result );
-
-on_error:
-	if( sub_key_item != NULL )
-	{
-		libregf_key_item_free(
-		 &sub_key_item,
-		 NULL );
 	}
-	return( -1 );
+	return( 1 );
 }
 
 /* Retrieves the key for the specific UTF-16 encoded path
  * The path separator is the \ character
  * Creates a new key
+ * If a key path cache is provided the longest previously resolved prefix
+ * of the path is looked up and only the remaining segments are resolved
  * Returns 1 if successful, 0 if no such key or -1 on error
  */
 int libregf_key_tree_get_sub_key_by_utf16_path(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     libregf_key_path_cache_t *key_path_cache,
      uint32_t key_offset,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
@@ -292,13 +2558,20 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 {
 	libregf_key_descriptor_t *sub_key_descriptor = NULL;
 	libregf_key_item_t *sub_key_item             = NULL;
+	libuna_unicode_character_t *upper_case_path  = NULL;
 	uint16_t *utf16_string_segment               = NULL;
 	static char *function                        = "libregf_key_tree_get_sub_key_by_utf16_path";
 	libuna_unicode_character_t unicode_character = 0;
+	size_t path_length                           = 0;
+	size_t upper_case_path_length                = 0;
 	size_t utf16_string_index                    = 0;
 	size_t utf16_string_segment_length           = 0;
+	size_t upper_case_path_string_index          = 0;
+	uint32_t cached_key_offset                   = 0;
 	uint32_t name_hash                           = 0;
+	uint32_t path_hash                           = 0;
 	uint32_t sub_key_offset                      = 0;
+	uint32_t upper_case_path_hash                = 0;
 	int result                                   = 0;
 
 	if( utf16_string == NULL )
@@ -356,6 +2629,140 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 			utf16_string_index++;
 		}
 	}
+	if( ( key_path_cache != NULL )
+	 && ( utf16_string_index < utf16_string_length ) )
+	{
+		if( ( utf16_string_length - utf16_string_index ) > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-16 string length value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		/* The number of Unicode characters cannot exceed the number of UTF-16 code units
+		 */
+		upper_case_path = (libuna_unicode_character_t *) memory_allocate(
+		                                                  sizeof( libuna_unicode_character_t ) * ( utf16_string_length - utf16_string_index ) );
+
+		if( upper_case_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create upper case path.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the longest prefix of the path that was resolved before
+		 * The separator is stored as LIBREGF_SEPARATOR in the upper case path
+		 */
+		upper_case_path_string_index = utf16_string_index;
+		upper_case_path_hash         = key_offset;
+		path_hash                    = key_offset;
+
+		while( upper_case_path_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &upper_case_path_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) LIBREGF_SEPARATOR;
+			}
+			else
+			{
+				unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 && ( upper_case_path_length > 0 ) )
+			{
+				result = libregf_key_path_cache_get_key_offset(
+				          key_path_cache,
+				          key_offset,
+				          upper_case_path,
+				          upper_case_path_length,
+				          upper_case_path_hash,
+				          &cached_key_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key offset from key path cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					utf16_string_index = upper_case_path_string_index;
+					path_length       = upper_case_path_length;
+					path_hash         = upper_case_path_hash;
+					sub_key_offset    = cached_key_offset;
+				}
+			}
+			upper_case_path[ upper_case_path_length++ ] = unicode_character;
+
+			upper_case_path_hash *= 37;
+			upper_case_path_hash += (uint32_t) unicode_character;
+
+			if( ( unicode_character != (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 && ( upper_case_path_string_index >= utf16_string_length ) )
+			{
+				result = libregf_key_path_cache_get_key_offset(
+				          key_path_cache,
+				          key_offset,
+				          upper_case_path,
+				          upper_case_path_length,
+				          upper_case_path_hash,
+				          &cached_key_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key offset from key path cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					utf16_string_index = upper_case_path_string_index;
+					path_length       = upper_case_path_length;
+					path_hash         = upper_case_path_hash;
+					sub_key_offset    = cached_key_offset;
+				}
+			}
+		}
+		result = 0;
+	}
 	/* If the string is empty return the current key
 	 */
 	if( utf16_string_length == utf16_string_index )
@@ -368,6 +2775,14 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 		utf16_string_segment_length = utf16_string_index;
 		name_hash                   = 0;
 
+		if( ( upper_case_path != NULL )
+		 && ( path_length > 0 ) )
+		{
+			/* Add the separator preceding the segment
+			 */
+			path_hash *= 37;
+			path_hash += (uint32_t) upper_case_path[ path_length++ ];
+		}
 		while( utf16_string_index < utf16_string_length )
 		{
 			if( libuna_unicode_character_copy_from_utf16(
@@ -395,6 +2810,12 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 			}
 			name_hash *= 37;
 			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+
+			if( upper_case_path != NULL )
+			{
+				path_hash *= 37;
+				path_hash += (uint32_t) upper_case_path[ path_length++ ];
+			}
 		}
 		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
 
@@ -405,37 +2826,63 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 		else
 		{
 /* TODO: instead of key item directory read key descriptors ? */
-			if( libregf_key_item_initialize(
-			     &sub_key_item,
-			     error ) != 1 )
+			if( key_item_cache != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub key item.",
-				 function );
+				if( libregf_key_item_cache_get_key_item(
+				     key_item_cache,
+				     file_io_handle,
+				     hive_bins_list,
+				     sub_key_offset,
+				     name_hash,
+				     &sub_key_item,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
 
-				goto on_error;
+					goto on_error;
+				}
 			}
-			if( libregf_key_item_read(
-			     sub_key_item,
-			     file_io_handle,
-			     hive_bins_list,
-			     sub_key_offset,
-			     name_hash,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_key_offset,
-				 sub_key_offset );
+				if( libregf_key_item_initialize(
+				     &sub_key_item,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create sub key item.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				if( libregf_key_item_read(
+				     sub_key_item,
+				     file_io_handle,
+				     hive_bins_list,
+				     sub_key_offset,
+				     name_hash,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					goto on_error;
+				}
 			}
 			result = libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 			          sub_key_item,
@@ -450,16 +2897,38 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 			if( result == 1 )
 			{
 				sub_key_offset = sub_key_descriptor->key_offset;
+
+				if( upper_case_path != NULL )
+				{
+					if( libregf_key_path_cache_set_key_offset(
+					     key_path_cache,
+					     key_offset,
+					     upper_case_path,
+					     path_length,
+					     path_hash,
+					     sub_key_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set key offset in key path cache.",
+						 function );
+
+						goto on_error;
+					}
+				}
 			}
-			if( libregf_key_item_free(
+			if( libregf_key_item_release_reference(
 			     &sub_key_item,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free sub key item.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release sub key item.",
 				 function );
 
 				goto on_error;
@@ -489,6 +2958,7 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 		     file_io_handle,
 		     sub_key_offset,
 		     hive_bins_list,
+		     key_item_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -501,15 +2971,25 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 			goto on_error;
 		}
 	}
+	if( upper_case_path != NULL )
+	{
+		memory_free(
+		 upper_case_path );
+	}
 	return( result );
 
 on_error:
 	if( sub_key_item != NULL )
 	{
-		libregf_key_item_free(
+		libregf_key_item_release_reference(
 		 &sub_key_item,
 		 NULL );
 	}
+	if( upper_case_path != NULL )
+	{
+		memory_free(
+		 upper_case_path );
+	}
 	return( -1 );
 }
 
@@ -25,8 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libregf_definitions.h"
+#include "libregf_hive_bin_cell.h"
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_key_path_cache.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_types.h"
@@ -35,20 +39,166 @@
 extern "C" {
 #endif
 
+typedef struct libregf_key_tree_utf8_path libregf_key_tree_utf8_path_t;
+
+struct libregf_key_tree_utf8_path
+{
+	/* The UTF-8 string without a leading separator
+	 */
+	const uint8_t *utf8_string;
+
+	/* The UTF-8 string length
+	 */
+	size_t utf8_string_length;
+
+	/* The index of the path in the paths provided by the caller
+	 */
+	int path_index;
+};
+
+typedef struct libregf_key_tree_walk_frame libregf_key_tree_walk_frame_t;
+
+struct libregf_key_tree_walk_frame
+{
+	/* The offset of the named key
+	 */
+	uint32_t key_offset;
+
+	/* The offset of the sub keys list
+	 */
+	uint32_t sub_keys_list_offset;
+
+	/* The index of the next element in the sub keys list
+	 */
+	uint16_t element_index;
+
+	/* The index of the next element in the sub keys list referenced by an index list element
+	 */
+	uint16_t sub_element_index;
+};
+
 int libregf_key_tree_get_sub_key_by_utf8_path(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     libregf_key_path_cache_t *key_path_cache,
      uint32_t key_offset,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
      libregf_key_t **sub_key,
      libcerror_error_t **error );
 
+int libregf_key_tree_get_sub_key_offset_by_utf8_name(
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
+int libregf_key_tree_utf8_path_compare(
+     libregf_key_tree_utf8_path_t *first_path,
+     libregf_key_tree_utf8_path_t *second_path,
+     libcerror_error_t **error );
+
+int libregf_key_tree_get_sub_keys_by_utf8_paths(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     const uint8_t **utf8_strings,
+     size_t *utf8_string_lengths,
+     int number_of_paths,
+     libregf_key_t **sub_keys,
+     libcerror_error_t **error );
+
+int libregf_key_tree_walk_read_sub_keys_list_element(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t sub_keys_list_offset,
+     uint16_t element_index,
+     uint32_t *element_offset,
+     uint8_t *is_index_list,
+     libcerror_error_t **error );
+
+int libregf_key_tree_walk_get_next_sub_key_offset(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_tree_walk_frame_t *walk_frame,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
+int libregf_key_tree_walk_read_named_key(
+     libregf_hive_bin_cell_t *named_key_cell,
+     size_t version_data_offset,
+     libregf_walk_key_t *walk_key,
+     uint32_t *values_list_offset,
+     uint32_t *sub_keys_list_offset,
+     libcerror_error_t **error );
+
+int libregf_key_tree_walk_read_value_key(
+     libregf_hive_bin_cell_t *value_key_cell,
+     size_t version_data_offset,
+     libregf_walk_value_t *walk_value,
+     libcerror_error_t **error );
+
+int libregf_key_tree_walk_key(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t parent_key_offset,
+     int depth,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     uint32_t *sub_keys_list_offset,
+     libcerror_error_t **error );
+
+int libregf_key_tree_walk(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libregf_key_tree_scan(
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
 int libregf_key_tree_get_sub_key_by_utf16_path(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_item_cache_t *key_item_cache,
+     libregf_key_path_cache_t *key_path_cache,
      uint32_t key_offset,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
@@ -0,0 +1,681 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* !defined( WINAPI ) */
+
+#include "libregf_libcerror.h"
+#include "libregf_memory_map.h"
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_memory_map_initialize(
+     libregf_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = memory_allocate_structure(
+	               libregf_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( libregf_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *memory_map != NULL )
+	{
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_memory_map_free(
+     libregf_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_memory_map_free";
+	int result            = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( ( *memory_map )->data != NULL )
+		{
+			if( libregf_memory_map_close(
+			     *memory_map,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close memory map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( result );
+}
+
+#if defined( WINAPI )
+
+/* Maps the file of a file handle into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_memory_map_map_file_handle(
+     libregf_memory_map_t *memory_map,
+     HANDLE file_handle,
+     libcerror_error_t **error )
+{
+	HANDLE file_mapping_handle = NULL;
+	static char *function      = "libregf_memory_map_map_file_handle";
+	size64_t file_size         = 0;
+	DWORD error_code           = 0;
+	DWORD file_size_lower      = 0;
+	DWORD file_size_upper      = 0;
+
+	file_size_lower = GetFileSize(
+	                   file_handle,
+	                   &file_size_upper );
+
+	if( file_size_lower == INVALID_FILE_SIZE )
+	{
+		error_code = GetLastError();
+
+		if( error_code != NO_ERROR )
+		{
+			libcerror_system_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 error_code,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_size = ( (size64_t) file_size_upper << 32 ) | file_size_lower;
+
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_mapping_handle = CreateFileMappingA(
+	                       file_handle,
+	                       NULL,
+	                       PAGE_READONLY,
+	                       0,
+	                       0,
+	                       NULL );
+
+	if( file_mapping_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	memory_map->data = (uint8_t *) MapViewOfFile(
+	                                file_mapping_handle,
+	                                FILE_MAP_READ,
+	                                0,
+	                                0,
+	                                0 );
+
+	if( memory_map->data == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to map view of file.",
+		 function );
+
+		CloseHandle(
+		 file_mapping_handle );
+
+		return( -1 );
+	}
+	/* The view remains valid after the file mapping handle is closed
+	 */
+	CloseHandle(
+	 file_mapping_handle );
+
+	memory_map->data_size = (size_t) file_size;
+
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBREGF_POSIX_MEMORY_MAP )
+
+/* Maps the file of a file descriptor into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_memory_map_map_file_descriptor(
+     libregf_memory_map_t *memory_map,
+     int file_descriptor,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libregf_memory_map_map_file_descriptor";
+	void *data            = NULL;
+
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file.",
+		 function );
+
+		return( -1 );
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Opens a memory map of a file
+ * The file is mapped read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_memory_map_open(
+     libregf_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+	DWORD error_code      = 0;
+#elif defined( HAVE_LIBREGF_POSIX_MEMORY_MAP )
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libregf_memory_map_open";
+	int result            = -1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileA(
+	               (LPCSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	result = libregf_memory_map_map_file_handle(
+	          memory_map,
+	          file_handle,
+	          error );
+
+	CloseHandle(
+	 file_handle );
+
+#elif defined( HAVE_LIBREGF_POSIX_MEMORY_MAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	result = libregf_memory_map_map_file_descriptor(
+	          memory_map,
+	          file_descriptor,
+	          error );
+
+	close(
+	 file_descriptor );
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files not supported.",
+	 function );
+
+#endif /* defined( WINAPI ) */
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a memory map of a file
+ * The file is mapped read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_memory_map_open_wide(
+     libregf_memory_map_t *memory_map,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+	DWORD error_code      = 0;
+#endif
+	static char *function = "libregf_memory_map_open_wide";
+	int result            = -1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileW(
+	               (LPCWSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	result = libregf_memory_map_map_file_handle(
+	          memory_map,
+	          file_handle,
+	          error );
+
+	CloseHandle(
+	 file_handle );
+
+#else
+	/* Wide character filenames are only mapped on Windows
+	 */
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files with a wide character filename not supported.",
+	 function );
+
+#endif /* defined( WINAPI ) */
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %ls.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes a memory map
+ * Returns 0 if successful or -1 on error
+ */
+int libregf_memory_map_close(
+     libregf_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_memory_map_close";
+	int result            = 0;
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#endif
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( UnmapViewOfFile(
+	     (LPCVOID) memory_map->data ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 error_code,
+		 "%s: unable to unmap view of file.",
+		 function );
+
+		result = -1;
+	}
+#elif defined( HAVE_LIBREGF_POSIX_MEMORY_MAP )
+	if( munmap(
+	     (void *) memory_map->data,
+	     memory_map->data_size ) != 0 )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to unmap file.",
+		 function );
+
+		result = -1;
+	}
+#endif /* defined( WINAPI ) */
+
+	memory_map->data      = NULL;
+	memory_map->data_size = 0;
+
+	return( result );
+}
+
@@ -0,0 +1,98 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_MEMORY_MAP_H )
+#define _LIBREGF_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+
+#if !defined( WINAPI ) && defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H )
+#define HAVE_LIBREGF_POSIX_MEMORY_MAP
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_memory_map libregf_memory_map_t;
+
+struct libregf_memory_map
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+};
+
+int libregf_memory_map_initialize(
+     libregf_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libregf_memory_map_free(
+     libregf_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+#if defined( WINAPI )
+
+int libregf_memory_map_map_file_handle(
+     libregf_memory_map_t *memory_map,
+     HANDLE file_handle,
+     libcerror_error_t **error );
+
+#elif defined( HAVE_LIBREGF_POSIX_MEMORY_MAP )
+
+int libregf_memory_map_map_file_descriptor(
+     libregf_memory_map_t *memory_map,
+     int file_descriptor,
+     libcerror_error_t **error );
+
+#endif /* defined( WINAPI ) */
+
+int libregf_memory_map_open(
+     libregf_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libregf_memory_map_open_wide(
+     libregf_memory_map_t *memory_map,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libregf_memory_map_close(
+     libregf_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_MEMORY_MAP_H ) */
+
@@ -0,0 +1,414 @@
+/*
+ * Name hash index functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+#include "libregf_name_hash_index.h"
+
+/* Creates a name hash index
+ * Make sure the value name_hash_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_name_hash_index_initialize(
+     libregf_name_hash_index_t **name_hash_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "libregf_name_hash_index_initialize";
+	uint32_t bucket_index      = 0;
+	uint32_t number_of_buckets = 1;
+	int entry_index            = 0;
+
+	if( name_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name hash index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of buckets is the smallest power of 2 that is equal to
+	 * or larger than the number of entries
+	 */
+	while( number_of_buckets < (uint32_t) number_of_entries )
+	{
+		number_of_buckets <<= 1;
+	}
+	*name_hash_index = memory_allocate_structure(
+	                    libregf_name_hash_index_t );
+
+	if( *name_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_hash_index,
+	     0,
+	     sizeof( libregf_name_hash_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name hash index.",
+		 function );
+
+		memory_free(
+		 *name_hash_index );
+
+		*name_hash_index = NULL;
+
+		return( -1 );
+	}
+	( *name_hash_index )->name_hashes = (uint32_t *) memory_allocate(
+	                                                  sizeof( uint32_t ) * number_of_entries );
+
+	if( ( *name_hash_index )->name_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_index )->next_entry_indexes = (int *) memory_allocate(
+	                                                    sizeof( int ) * number_of_entries );
+
+	if( ( *name_hash_index )->next_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create next entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_index )->bucket_entry_indexes = (int *) memory_allocate(
+	                                                      sizeof( int ) * number_of_buckets );
+
+	if( ( *name_hash_index )->bucket_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		( *name_hash_index )->name_hashes[ entry_index ]        = 0;
+		( *name_hash_index )->next_entry_indexes[ entry_index ] = -2;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		( *name_hash_index )->bucket_entry_indexes[ bucket_index ] = -1;
+	}
+	( *name_hash_index )->number_of_entries = number_of_entries;
+	( *name_hash_index )->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *name_hash_index != NULL )
+	{
+		if( ( *name_hash_index )->next_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_index )->next_entry_indexes );
+		}
+		if( ( *name_hash_index )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_index )->name_hashes );
+		}
+		memory_free(
+		 *name_hash_index );
+
+		*name_hash_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name hash index
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_name_hash_index_free(
+     libregf_name_hash_index_t **name_hash_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_name_hash_index_free";
+
+	if( name_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_index != NULL )
+	{
+		if( ( *name_hash_index )->bucket_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_index )->bucket_entry_indexes );
+		}
+		if( ( *name_hash_index )->next_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_index )->next_entry_indexes );
+		}
+		if( ( *name_hash_index )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_index )->name_hashes );
+		}
+		memory_free(
+		 *name_hash_index );
+
+		*name_hash_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the name hash of a specific entry
+ * An entry is added to the front of its bucket, hence entries that share a bucket
+ * are retrieved in the reverse order in which they were set
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_name_hash_index_set_entry(
+     libregf_name_hash_index_t *name_hash_index,
+     int entry_index,
+     uint32_t name_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_name_hash_index_set_entry";
+	uint32_t bucket_index = 0;
+
+	if( name_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= name_hash_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_index->next_entry_indexes[ entry_index ] != -2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry: %d value already set.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	bucket_index = name_hash & ( name_hash_index->number_of_buckets - 1 );
+
+	name_hash_index->name_hashes[ entry_index ]          = name_hash;
+	name_hash_index->next_entry_indexes[ entry_index ]   = name_hash_index->bucket_entry_indexes[ bucket_index ];
+	name_hash_index->bucket_entry_indexes[ bucket_index ] = entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the first entry with a specific name hash
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libregf_name_hash_index_get_first_entry_index(
+     libregf_name_hash_index_t *name_hash_index,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_name_hash_index_get_first_entry_index";
+	uint32_t bucket_index = 0;
+	int safe_entry_index  = 0;
+
+	if( name_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = name_hash & ( name_hash_index->number_of_buckets - 1 );
+
+	safe_entry_index = name_hash_index->bucket_entry_indexes[ bucket_index ];
+
+	while( safe_entry_index >= 0 )
+	{
+		if( name_hash_index->name_hashes[ safe_entry_index ] == name_hash )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = name_hash_index->next_entry_indexes[ safe_entry_index ];
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the next entry with a specific name hash
+ * The entry index should contain the index of the previous entry with the name hash
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libregf_name_hash_index_get_next_entry_index(
+     libregf_name_hash_index_t *name_hash_index,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_name_hash_index_get_next_entry_index";
+	int safe_entry_index  = 0;
+
+	if( name_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *entry_index < 0 )
+	 || ( *entry_index >= name_hash_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry_index = name_hash_index->next_entry_indexes[ *entry_index ];
+
+	while( safe_entry_index >= 0 )
+	{
+		if( name_hash_index->name_hashes[ safe_entry_index ] == name_hash )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = name_hash_index->next_entry_indexes[ safe_entry_index ];
+	}
+	return( 0 );
+}
+
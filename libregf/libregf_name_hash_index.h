@@ -0,0 +1,92 @@
+/*
+ * Name hash index functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_NAME_HASH_INDEX_H )
+#define _LIBREGF_NAME_HASH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_name_hash_index libregf_name_hash_index_t;
+
+struct libregf_name_hash_index
+{
+	/* The name hash of every entry
+	 */
+	uint32_t *name_hashes;
+
+	/* The index of the first entry of every bucket or -1 if the bucket is empty
+	 */
+	int *bucket_entry_indexes;
+
+	/* The index of the next entry in the same bucket, -1 if there is none
+	 * or -2 if the entry has not been set
+	 */
+	int *next_entry_indexes;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+};
+
+int libregf_name_hash_index_initialize(
+     libregf_name_hash_index_t **name_hash_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libregf_name_hash_index_free(
+     libregf_name_hash_index_t **name_hash_index,
+     libcerror_error_t **error );
+
+int libregf_name_hash_index_set_entry(
+     libregf_name_hash_index_t *name_hash_index,
+     int entry_index,
+     uint32_t name_hash,
+     libcerror_error_t **error );
+
+int libregf_name_hash_index_get_first_entry_index(
+     libregf_name_hash_index_t *name_hash_index,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libregf_name_hash_index_get_next_entry_index(
+     libregf_name_hash_index_t *name_hash_index,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_NAME_HASH_INDEX_H ) */
+
@@ -1283,6 +1283,274 @@ int libregf_named_key_compare_name_with_utf16_string(
 	return( 0 );
 }
 
+/* Compares the sort order of the key name with an UTF-8 string
+ * Sub key lists are sorted by the upper case key name
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libregf_named_key_compare_sort_order_with_utf8_string(
+     libregf_named_key_t *named_key,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libregf_named_key_compare_sort_order_with_utf8_string";
+	libuna_unicode_character_t name_character   = 0;
+	libuna_unicode_character_t string_character = 0;
+	size_t name_index                           = 0;
+	size_t utf8_string_index                    = 0;
+	int result                                  = 0;
+
+	if( named_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid named key.",
+		 function );
+
+		return( -1 );
+	}
+	if( named_key->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid named key - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < (size_t) named_key->name_size )
+	{
+		if( utf8_string_index >= utf8_string_length )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+		if( ( named_key->flags & LIBREGF_NAMED_KEY_FLAG_NAME_IS_ASCII ) != 0 )
+		{
+			result = libuna_unicode_character_copy_from_byte_stream(
+				  &name_character,
+				  named_key->name,
+				  (size_t) named_key->name_size,
+				  &name_index,
+				  ascii_codepage,
+				  error );
+		}
+		else
+		{
+			result = libuna_unicode_character_copy_from_utf16_stream(
+				  &name_character,
+				  named_key->name,
+				  (size_t) named_key->name_size,
+				  &name_index,
+				  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+				  error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy key name to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_from_utf8(
+		     &string_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		name_character   = (libuna_unicode_character_t) towupper( (wint_t) name_character );
+		string_character = (libuna_unicode_character_t) towupper( (wint_t) string_character );
+
+		if( name_character < string_character )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( name_character > string_character )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	if( utf8_string_index < utf8_string_length )
+	{
+		return( LIBUNA_COMPARE_LESS );
+	}
+	return( LIBUNA_COMPARE_EQUAL );
+}
+
+/* Compares the sort order of the key name with an UTF-16 string
+ * Sub key lists are sorted by the upper case key name
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libregf_named_key_compare_sort_order_with_utf16_string(
+     libregf_named_key_t *named_key,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libregf_named_key_compare_sort_order_with_utf16_string";
+	libuna_unicode_character_t name_character   = 0;
+	libuna_unicode_character_t string_character = 0;
+	size_t name_index                           = 0;
+	size_t utf16_string_index                   = 0;
+	int result                                  = 0;
+
+	if( named_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid named key.",
+		 function );
+
+		return( -1 );
+	}
+	if( named_key->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid named key - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < (size_t) named_key->name_size )
+	{
+		if( utf16_string_index >= utf16_string_length )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+		if( ( named_key->flags & LIBREGF_NAMED_KEY_FLAG_NAME_IS_ASCII ) != 0 )
+		{
+			result = libuna_unicode_character_copy_from_byte_stream(
+				  &name_character,
+				  named_key->name,
+				  (size_t) named_key->name_size,
+				  &name_index,
+				  ascii_codepage,
+				  error );
+		}
+		else
+		{
+			result = libuna_unicode_character_copy_from_utf16_stream(
+				  &name_character,
+				  named_key->name,
+				  (size_t) named_key->name_size,
+				  &name_index,
+				  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+				  error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy key name to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_from_utf16(
+		     &string_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		name_character   = (libuna_unicode_character_t) towupper( (wint_t) name_character );
+		string_character = (libuna_unicode_character_t) towupper( (wint_t) string_character );
+
+		if( name_character < string_character )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( name_character > string_character )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	if( utf16_string_index < utf16_string_length )
+	{
+		return( LIBUNA_COMPARE_LESS );
+	}
+	return( LIBUNA_COMPARE_EQUAL );
+}
+
 /* Retrieves the 64-bit FILETIME value of the last written date and time
  * Returns 1 if successful or -1 on error
  */
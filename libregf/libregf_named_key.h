@@ -154,6 +154,20 @@ int libregf_named_key_compare_name_with_utf16_string(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libregf_named_key_compare_sort_order_with_utf8_string(
+     libregf_named_key_t *named_key,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libregf_named_key_compare_sort_order_with_utf16_string(
+     libregf_named_key_t *named_key,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
 int libregf_named_key_get_last_written_time(
      libregf_named_key_t *named_key,
      uint64_t *filetime,
@@ -26,6 +26,7 @@
 
 #include "libregf_debug.h"
 #include "libregf_io_handle.h"
+#include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
 #include "libregf_libfwnt.h"
@@ -141,6 +142,49 @@ int libregf_security_key_free(
 	return( 1 );
 }
 
+/* Compares two security keys by their offset
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libregf_security_key_compare_by_offset(
+     libregf_security_key_t *first_security_key,
+     libregf_security_key_t *second_security_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_security_key_compare_by_offset";
+
+	if( first_security_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first security key.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_security_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second security key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_security_key->offset < second_security_key->offset )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_security_key->offset > second_security_key->offset )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
 /* Reads a security key
  * Returns 1 if successful or -1 on error
  */
@@ -36,6 +36,10 @@ typedef struct libregf_security_key libregf_security_key_t;
 
 struct libregf_security_key
 {
+	/* The (hive bin cell) offset
+	 */
+	uint32_t offset;
+
 	/* The security descriptor
 	 */
 	uint8_t *security_descriptor;
@@ -53,6 +57,11 @@ int libregf_security_key_free(
      libregf_security_key_t **security_key,
      libcerror_error_t **error );
 
+int libregf_security_key_compare_by_offset(
+     libregf_security_key_t *first_security_key,
+     libregf_security_key_t *second_security_key,
+     libcerror_error_t **error );
+
 int libregf_security_key_read_data(
      libregf_security_key_t *security_key,
      libregf_io_handle_t *io_handle,
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libregf_definitions.h"
 #include "libregf_key_descriptor.h"
 #include "libregf_io_handle.h"
 #include "libregf_libcdata.h"
@@ -187,6 +188,7 @@ int libregf_sub_key_list_read_data(
 	uint16_t element_index                       = 0;
 	uint16_t number_of_elements                  = 0;
 	uint8_t element_data_size                    = 0;
+	uint8_t hash_type                            = 0;
 	int entry_index                              = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -277,10 +279,17 @@ int libregf_sub_key_list_read_data(
 		sub_key_list->at_leaf_level = 1;
 	}
 	else if( ( data[ data_offset ] == (uint8_t) 'l' )
-	      && ( ( data[ data_offset + 1 ] == (uint8_t) 'f' )
-	        || ( data[ data_offset + 1 ] == (uint8_t) 'h' ) ) )
+	      && ( data[ data_offset + 1 ] == (uint8_t) 'f' ) )
 	{
 		element_data_size           = 8;
+		hash_type                   = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HINT;
+		sub_key_list->at_leaf_level = 1;
+	}
+	else if( ( data[ data_offset ] == (uint8_t) 'l' )
+	      && ( data[ data_offset + 1 ] == (uint8_t) 'h' ) )
+	{
+		element_data_size           = 8;
+		hash_type                   = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH;
 		sub_key_list->at_leaf_level = 1;
 	}
 	else
@@ -368,6 +377,8 @@ int libregf_sub_key_list_read_data(
 			 &( data[ data_offset ] ),
 			 sub_key_descriptor->hash_value );
 
+			sub_key_descriptor->hash_type = hash_type;
+
 			data_offset += 4;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
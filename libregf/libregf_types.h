@@ -47,6 +47,90 @@ typedef intptr_t libregf_value_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The key information passed to the key callback of a walk or scan
+ * The name is only valid for the duration of the callback
+ */
+typedef struct libregf_walk_key libregf_walk_key_t;
+
+struct libregf_walk_key
+{
+	/* The offset of the named key
+	 */
+	uint32_t offset;
+
+	/* The offset of the named key of the parent key
+	 */
+	uint32_t parent_offset;
+
+	/* The depth, where the root key has depth 0, or -1 when not known such as in a scan
+	 */
+	int depth;
+
+	/* The name, which is either an ASCII string or an UTF-16 little-endian string
+	 */
+	const uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* Value to indicate the name is an ASCII string
+	 */
+	uint8_t name_is_ascii;
+
+	/* The last written date and time, which contains a FILETIME
+	 */
+	uint64_t last_written_time;
+
+	/* The number of sub keys
+	 */
+	uint32_t number_of_sub_keys;
+
+	/* The number of values
+	 */
+	uint32_t number_of_values;
+};
+
+/* The value information passed to the value callback of a walk or scan
+ * The name is only valid for the duration of the callback
+ */
+typedef struct libregf_walk_value libregf_walk_value_t;
+
+struct libregf_walk_value
+{
+	/* The offset of the value key
+	 */
+	uint32_t offset;
+
+	/* The offset of the named key of the key that contains the value
+	 */
+	uint32_t key_offset;
+
+	/* The depth of the key that contains the value, or -1 when not known such as in a scan
+	 */
+	int depth;
+
+	/* The name, which is either an ASCII string or an UTF-16 little-endian string
+	 */
+	const uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* Value to indicate the name is an ASCII string
+	 */
+	uint8_t name_is_ascii;
+
+	/* The value type
+	 */
+	uint32_t value_type;
+
+	/* The value data size
+	 */
+	uint32_t data_size;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBREGF ) */
 
 #endif /* !defined( _LIBREGF_INTERNAL_TYPES_H ) */
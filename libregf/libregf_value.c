@@ -143,6 +143,24 @@ int libregf_value_initialize(
 	internal_value->io_handle      = io_handle;
 	internal_value->file_offset    = file_offset;
 
+	if( io_handle != NULL )
+	{
+		if( libregf_io_handle_increment_counter(
+		     io_handle,
+		     LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_VALUES_MATERIALIZED,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment number of values materialized.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	*value = (libregf_value_t *) internal_value;
 
 	return( 1 );
@@ -150,6 +168,14 @@ int libregf_value_initialize(
 on_error:
 	if( internal_value != NULL )
 	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( internal_value->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_value->read_write_lock ),
+			 NULL );
+		}
+#endif
 		if( internal_value->value_item != NULL )
 		{
 			libregf_value_item_free(
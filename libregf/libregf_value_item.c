@@ -29,6 +29,7 @@
 #include "libregf_definitions.h"
 #include "libregf_hive_bin_cell.h"
 #include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
@@ -332,7 +333,7 @@ int libregf_value_item_read_value_key(
      uint32_t value_key_offset,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
 	static char *function                  = "libregf_value_item_read_value_key";
 	size_t value_key_data_size             = 0;
 	int hive_bin_index                     = 0;
@@ -419,7 +420,7 @@ int libregf_value_item_read_value_key(
 
 		goto on_error;
 	}
-	if( hive_bin_cell->size < value_key_data_size )
+	if( hive_bin_cell.size < value_key_data_size )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -431,6 +432,19 @@ int libregf_value_item_read_value_key(
 #endif
 		value_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
 
+		if( libregf_hive_bin_cell_free_data(
+		     &hive_bin_cell,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hive bin cell data.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	if( libregf_value_key_initialize(
@@ -450,8 +464,8 @@ int libregf_value_item_read_value_key(
 	result = libregf_value_key_read_data(
 	          value_item->value_key,
 	          hive_bins_list->io_handle,
-	          hive_bin_cell->data,
-	          hive_bin_cell->size,
+	          hive_bin_cell.data,
+	          hive_bin_cell.size,
 	          0,
 	          error );
 
@@ -468,7 +482,20 @@ int libregf_value_item_read_value_key(
 
 		goto on_error;
 	}
-	else if( result == 0 )
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -483,7 +510,7 @@ int libregf_value_item_read_value_key(
 		return( 1 );
 	}
 /* TODO
-		if( value_item->name_size > hive_bin_cell->size )
+		if( value_item->name_size > hive_bin_cell.size )
 		{
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -575,6 +602,10 @@ int libregf_value_item_read_value_key(
 	return( 1 );
 
 on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
 	if( value_item->data_buffer != NULL )
 	{
 		memory_free(
@@ -605,7 +636,7 @@ int libregf_value_item_read_value_data(
      libcerror_error_t **error )
 {
 	libregf_data_block_key_t *data_block_key = NULL;
-	libregf_hive_bin_cell_t *hive_bin_cell   = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
 	static char *function                    = "libregf_value_item_read_value_data";
 	size_t data_offset                       = 0;
 	size_t utf16_string_size                 = 0;
@@ -697,8 +728,8 @@ int libregf_value_item_read_value_data(
 		}
 		result = libregf_data_block_key_read_data(
 		          data_block_key,
-		          hive_bin_cell->data,
-		          hive_bin_cell->size,
+		          hive_bin_cell.data,
+		          hive_bin_cell.size,
 		          error );
 
 		if( result == -1 )
@@ -781,8 +812,8 @@ int libregf_value_item_read_value_data(
 			 "%s: data:\n",
 			 function );
 			libcnotify_print_data(
-			 hive_bin_cell->data,
-			 hive_bin_cell->size,
+			 hive_bin_cell.data,
+			 hive_bin_cell.size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif
@@ -791,7 +822,7 @@ int libregf_value_item_read_value_data(
 		{
 			data_offset = 4;
 		}
-		if( value_data_size > hive_bin_cell->size )
+		if( value_data_size > hive_bin_cell.size )
 		{
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -800,12 +831,12 @@ int libregf_value_item_read_value_data(
 				 "%s: value data size: %" PRIu32 " exceeds hive bin cell size: %" PRIzd ".\n",
 				 function,
 				 value_data_size,
-				 hive_bin_cell->size );
+				 hive_bin_cell.size );
 			}
 #endif
 			value_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
 
-			if( hive_bin_cell->size > (uint32_t) INT32_MAX )
+			if( hive_bin_cell.size > (uint32_t) INT32_MAX )
 			{
 				libcerror_error_set(
 				 error,
@@ -816,7 +847,7 @@ int libregf_value_item_read_value_data(
 
 				goto on_error;
 			}
-			value_data_size = (uint32_t) hive_bin_cell->size;
+			value_data_size = (uint32_t) hive_bin_cell.size;
 		}
 		if( libregf_value_key_get_value_type(
 		     value_item->value_key,
@@ -837,10 +868,10 @@ int libregf_value_item_read_value_data(
 		{
 			calculated_value_data_size = data_offset;
 
-			while( ( calculated_value_data_size + 2 ) <= (uint32_t) hive_bin_cell->size )
+			while( ( calculated_value_data_size + 2 ) <= (uint32_t) hive_bin_cell.size )
 			{
-				if( ( hive_bin_cell->data[ calculated_value_data_size ] == 0 )
-				 && ( hive_bin_cell->data[ calculated_value_data_size + 1 ] == 0 ) )
+				if( ( hive_bin_cell.data[ calculated_value_data_size ] == 0 )
+				 && ( hive_bin_cell.data[ calculated_value_data_size + 1 ] == 0 ) )
 				{
 					calculated_value_data_size += 2;
 
@@ -855,7 +886,7 @@ int libregf_value_item_read_value_data(
 				/* Check if the calculated string is sane
 				 */
 				result = libuna_utf16_string_size_from_utf16_stream(
-					  &( hive_bin_cell->data[ data_offset ] ),
+					  &( hive_bin_cell.data[ data_offset ] ),
 					  calculated_value_data_size,
 					  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
 					  &utf16_string_size,
@@ -919,7 +950,7 @@ int libregf_value_item_read_value_data(
 
 			if( memory_copy(
 			     value_item->data_buffer,
-			     &( hive_bin_cell->data[ data_offset ] ),
+			     &( hive_bin_cell.data[ data_offset ] ),
 			     value_data_size  ) == NULL )
 			{
 				libcerror_error_set(
@@ -938,22 +969,39 @@ int libregf_value_item_read_value_data(
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			if( data_offset < hive_bin_cell->size )
+			if( data_offset < hive_bin_cell.size )
 			{
 				libcnotify_printf(
 				 "%s: padding:\n",
 				 function );
 				libcnotify_print_data(
-				 &( hive_bin_cell->data[ data_offset ] ),
-				 hive_bin_cell->size - data_offset,
+				 &( hive_bin_cell.data[ data_offset ] ),
+				 hive_bin_cell.size - data_offset,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
 	if( value_item->data_buffer != NULL )
 	{
 		memory_free(
@@ -982,7 +1030,7 @@ int libregf_value_item_read_data_block_list(
      uint32_t value_data_size,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
 	uint8_t *list_data                     = NULL;
 	static char *function                  = "libregf_value_item_read_data_block_list";
 	size_t data_offset                     = 0;
@@ -1058,18 +1106,7 @@ int libregf_value_item_read_data_block_list(
 
 		return( 0 );
 	}
-	if( hive_bin_cell == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing hive bins cell.",
-		 function );
-
-		return( -1 );
-	}
-	list_data_size = (size_t) hive_bin_cell->size;
+	list_data_size = (size_t) hive_bin_cell.size;
 
 	if( ( list_data_size == 0 )
 	 || ( list_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
@@ -1101,7 +1138,7 @@ int libregf_value_item_read_data_block_list(
 	}
 	if( memory_copy(
 	     list_data,
-	     hive_bin_cell->data,
+	     hive_bin_cell.data,
 	     list_data_size ) == NULL )
 	{
 		libcerror_error_set(
@@ -1113,6 +1150,19 @@ int libregf_value_item_read_data_block_list(
 
 		goto on_error;
 	}
+	if( libregf_hive_bin_cell_free_data(
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin cell data.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1227,8 +1277,21 @@ int libregf_value_item_read_data_block_list(
 				return( 0 );
 			}
 			segment_offset = (uint32_t) ( hive_bins_list->io_handle->hive_bins_list_offset + 4 + element_offset );
-			segment_size   = hive_bin_cell->size - 4;
+			segment_size   = hive_bin_cell.size - 4;
 
+			if( libregf_hive_bin_cell_free_data(
+			     &hive_bin_cell,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin cell data.",
+				 function );
+
+				goto on_error;
+			}
 			if( segment_size > 16344 )
 			{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1309,6 +1372,10 @@ int libregf_value_item_read_data_block_list(
 	return( 1 );
 
 on_error:
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
 	if( value_item->data_stream != NULL )
 	{
 		libfdata_stream_free(
@@ -1379,6 +1446,21 @@ int libregf_value_item_read_element_data(
 
 		goto on_error;
 	}
+	if( libregf_io_handle_increment_counter(
+	     hive_bins_list->io_handle,
+	     LIBREGF_IO_HANDLE_COUNTER_VALUES_CACHE_MISSES,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to increment values cache misses.",
+		 function );
+
+		goto on_error;
+	}
 	if( libregf_value_item_initialize(
 	     &value_item,
 	     error ) != 1 )
@@ -1411,7 +1493,19 @@ int libregf_value_item_read_element_data(
 	}
 	if( ( value_item->item_flags & LIBREGF_ITEM_FLAG_IS_CORRUPTED ) != 0 )
 	{
-		hive_bins_list->io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED;
+		if( libregf_io_handle_set_corrupted(
+		     hive_bins_list->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to mark file as corrupted.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libfdata_list_element_set_element_value(
 	     list_element,
@@ -0,0 +1,1427 @@
+/*
+ * Walk scheduler functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_definitions.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_key_tree.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_types.h"
+#include "libregf_walk_scheduler.h"
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+
+/* Creates a walk scheduler
+ * Make sure the value scheduler is referencing, is set to NULL
+ * The hive bins list must be frozen, since the workers retrieve hive bin cells concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_initialize(
+     libregf_walk_scheduler_t **scheduler,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     int number_of_workers,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void **user_data,
+     libcerror_error_t **error )
+{
+	libregf_walk_scheduler_worker_t *worker = NULL;
+	static char *function                   = "libregf_walk_scheduler_initialize";
+	int is_frozen                           = 0;
+	int worker_index                        = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	is_frozen = libregf_hive_bins_list_is_frozen(
+	             hive_bins_list,
+	             error );
+
+	if( is_frozen == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if hive bins list is frozen.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_frozen == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing hive bins, hive bins list is not frozen.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBREGF_MAXIMUM_NUMBER_OF_WALK_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key callback.",
+		 function );
+
+		return( -1 );
+	}
+	*scheduler = memory_allocate_structure(
+	              libregf_walk_scheduler_t );
+
+	if( *scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scheduler,
+	     0,
+	     sizeof( libregf_walk_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scheduler.",
+		 function );
+
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+
+		return( -1 );
+	}
+	( *scheduler )->workers = (libregf_walk_scheduler_worker_t *) memory_allocate(
+	                                                               sizeof( libregf_walk_scheduler_worker_t ) * number_of_workers );
+
+	if( ( *scheduler )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scheduler )->workers,
+	     0,
+	     sizeof( libregf_walk_scheduler_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 ( *scheduler )->workers );
+
+		( *scheduler )->workers = NULL;
+
+		goto on_error;
+	}
+	( *scheduler )->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( ( *scheduler )->workers[ worker_index ] );
+
+		worker->scheduler    = *scheduler;
+		worker->worker_index = worker_index;
+
+		if( user_data != NULL )
+		{
+			worker->user_data = user_data[ worker_index ];
+		}
+		if( libcthreads_mutex_initialize(
+		     &( worker->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize worker: %d mutex.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *scheduler )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *scheduler )->io_handle      = io_handle;
+	( *scheduler )->file_io_handle = file_io_handle;
+	( *scheduler )->hive_bins_list = hive_bins_list;
+	( *scheduler )->key_callback   = key_callback;
+	( *scheduler )->value_callback = value_callback;
+
+	return( 1 );
+
+on_error:
+	if( *scheduler != NULL )
+	{
+		libregf_walk_scheduler_free(
+		 scheduler,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a walk scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_free(
+     libregf_walk_scheduler_t **scheduler,
+     libcerror_error_t **error )
+{
+	libregf_walk_scheduler_worker_t *worker = NULL;
+	static char *function                   = "libregf_walk_scheduler_free";
+	int result                              = 1;
+	int worker_index                        = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scheduler != NULL )
+	{
+		if( ( *scheduler )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *scheduler )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scheduler )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *scheduler )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scheduler )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *scheduler )->number_of_workers;
+			     worker_index++ )
+			{
+				worker = &( ( *scheduler )->workers[ worker_index ] );
+
+				if( worker->mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( worker->mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free worker: %d mutex.",
+						 function,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+				if( worker->items != NULL )
+				{
+					memory_free(
+					 worker->items );
+				}
+				if( worker->error != NULL )
+				{
+					libcerror_error_free(
+					 &( worker->error ) );
+				}
+			}
+			memory_free(
+			 ( *scheduler )->workers );
+		}
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Adds an item to the end of the items of a worker
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_worker_push_item(
+     libregf_walk_scheduler_worker_t *worker,
+     uint32_t key_offset,
+     uint32_t parent_key_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	libregf_walk_scheduler_item_t *items = NULL;
+	static char *function                = "libregf_walk_scheduler_worker_push_item";
+	int item_index                       = 0;
+	int number_of_allocated_items        = 0;
+	int result                           = 1;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->number_of_items >= worker->number_of_allocated_items )
+	{
+		if( worker->first_item_index > 0 )
+		{
+			/* Reuse the space of the items taken by other workers,
+			 * the items are moved one by one since the ranges can overlap
+			 */
+			for( item_index = worker->first_item_index;
+			     item_index < worker->number_of_items;
+			     item_index++ )
+			{
+				worker->items[ item_index - worker->first_item_index ] = worker->items[ item_index ];
+			}
+			worker->number_of_items -= worker->first_item_index;
+			worker->first_item_index = 0;
+		}
+		else
+		{
+			if( worker->number_of_allocated_items == 0 )
+			{
+				number_of_allocated_items = 64;
+			}
+			else
+			{
+				number_of_allocated_items = worker->number_of_allocated_items * 2;
+			}
+			if( ( number_of_allocated_items <= worker->number_of_allocated_items )
+			 || ( (size_t) number_of_allocated_items > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libregf_walk_scheduler_item_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of allocated items value out of bounds.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				items = (libregf_walk_scheduler_item_t *) memory_reallocate(
+				                                           worker->items,
+				                                           sizeof( libregf_walk_scheduler_item_t ) * number_of_allocated_items );
+
+				if( items == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize items.",
+					 function );
+
+					result = -1;
+				}
+				else
+				{
+					worker->items                     = items;
+					worker->number_of_allocated_items = number_of_allocated_items;
+				}
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		worker->items[ worker->number_of_items ].key_offset        = key_offset;
+		worker->items[ worker->number_of_items ].parent_key_offset = parent_key_offset;
+		worker->items[ worker->number_of_items ].depth             = depth;
+
+		worker->number_of_items += 1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Removes the item at the end of the items of a worker
+ * The worker takes the last item added, which walks its part of the key tree depth first
+ * Returns 1 if successful, 0 if no item is available or -1 on error
+ */
+int libregf_walk_scheduler_worker_pop_item(
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_walk_scheduler_worker_pop_item";
+	int result            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker->abort == 0 )
+	 && ( worker->number_of_items > worker->first_item_index ) )
+	{
+		worker->number_of_items -= 1;
+
+		*item = worker->items[ worker->number_of_items ];
+
+		if( worker->number_of_items == worker->first_item_index )
+		{
+			worker->first_item_index = 0;
+			worker->number_of_items  = 0;
+		}
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Removes the item at the start of the items of a worker on behalf of another worker
+ * The first item was added earliest and is the closest to the root key, hence likely has the largest sub tree
+ * Returns 1 if successful, 0 if no item is available or -1 on error
+ */
+int libregf_walk_scheduler_worker_steal_item(
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_walk_scheduler_worker_steal_item";
+	int result            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker->abort == 0 )
+	 && ( worker->number_of_items > worker->first_item_index ) )
+	{
+		*item = worker->items[ worker->first_item_index ];
+
+		worker->first_item_index += 1;
+
+		if( worker->number_of_items == worker->first_item_index )
+		{
+			worker->first_item_index = 0;
+			worker->number_of_items  = 0;
+		}
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next item for a worker
+ * The worker takes its own items first, then the items of the other workers
+ * and otherwise waits until items are added or all the workers are idle
+ * Returns 1 if successful, 0 if the walk has completed or was aborted or -1 on error
+ */
+int libregf_walk_scheduler_get_item(
+     libregf_walk_scheduler_t *scheduler,
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_walk_scheduler_get_item";
+	uint32_t generation   = 0;
+	uint8_t retry         = 0;
+	int result            = 0;
+	int worker_index      = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		/* The generation is retrieved before the items are checked so that
+		 * items added after the check are not missed when waiting
+		 */
+		if( libcthreads_mutex_grab(
+		     scheduler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		generation = scheduler->generation;
+		result     = ( scheduler->abort == 0 ) ? 1 : 0;
+
+		if( libcthreads_mutex_release(
+		     scheduler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libregf_walk_scheduler_worker_pop_item(
+		          worker,
+		          item,
+		          error );
+
+		for( worker_index = 1;
+		     ( result == 0 ) && ( worker_index < scheduler->number_of_workers );
+		     worker_index++ )
+		{
+			result = libregf_walk_scheduler_worker_steal_item(
+			          &( scheduler->workers[ ( worker->worker_index + worker_index ) % scheduler->number_of_workers ] ),
+			          item,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		if( libcthreads_mutex_grab(
+		     scheduler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		scheduler->number_of_idle_workers += 1;
+
+		retry = 0;
+
+		while( ( scheduler->done == 0 )
+		    && ( scheduler->abort == 0 ) )
+		{
+			if( scheduler->number_of_idle_workers == scheduler->number_of_workers )
+			{
+				/* All the workers are idle hence no more items can be added
+				 */
+				scheduler->done = 1;
+
+				result = libcthreads_condition_broadcast(
+				          scheduler->condition,
+				          error );
+			}
+			else if( scheduler->generation != generation )
+			{
+				retry = 1;
+			}
+			else
+			{
+				result = libcthreads_condition_wait(
+				          scheduler->condition,
+				          scheduler->mutex,
+				          error );
+			}
+			if( ( result == -1 )
+			 || ( retry != 0 ) )
+			{
+				break;
+			}
+		}
+		scheduler->number_of_idle_workers -= 1;
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for items.",
+			 function );
+		}
+		if( libcthreads_mutex_release(
+		     scheduler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+	}
+	while( retry != 0 );
+
+	return( 0 );
+}
+
+/* Signals the idle workers that items were added
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_signal_items(
+     libregf_walk_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_walk_scheduler_signal_items";
+	int result            = 1;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	scheduler->generation += 1;
+
+	if( scheduler->number_of_idle_workers > 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     scheduler->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Aborts the walk
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_abort(
+     libregf_walk_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	libregf_walk_scheduler_worker_t *worker = NULL;
+	static char *function                   = "libregf_walk_scheduler_abort";
+	int result                              = 1;
+	int worker_index                        = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	/* The workers check their own abort value when taking an item,
+	 * so that a busy worker does not need to grab the mutex of the scheduler
+	 */
+	for( worker_index = 0;
+	     worker_index < scheduler->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( scheduler->workers[ worker_index ] );
+
+		if( libcthreads_mutex_grab(
+		     worker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab worker: %d mutex.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+		worker->abort = 1;
+
+		if( libcthreads_mutex_release(
+		     worker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release worker: %d mutex.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	scheduler->abort = 1;
+
+	if( libcthreads_condition_broadcast(
+	     scheduler->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Walks the key of an item and adds its sub keys to the items of the worker
+ * The hive bin cells are retrieved from the frozen hive bins without file IO
+ * and, if the compiler provides atomic operations, without locking
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_walk_item(
+     libregf_walk_scheduler_t *scheduler,
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error )
+{
+	libregf_key_tree_walk_frame_t walk_frame;
+
+	static char *function         = "libregf_walk_scheduler_walk_item";
+	uint32_t sub_key_offset       = 0;
+	uint32_t sub_keys_list_offset = 0;
+	int number_of_sub_keys        = 0;
+	int result                    = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_key_tree_walk_key(
+	          scheduler->io_handle,
+	          scheduler->file_io_handle,
+	          scheduler->hive_bins_list,
+	          item->key_offset,
+	          item->parent_key_offset,
+	          item->depth,
+	          scheduler->key_callback,
+	          scheduler->value_callback,
+	          worker->user_data,
+	          &sub_keys_list_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to walk key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 item->key_offset,
+		 item->key_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* A loop in the key tree would otherwise be walked indefinitely
+	 */
+	if( item->depth >= LIBREGF_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	walk_frame.key_offset           = item->key_offset;
+	walk_frame.sub_keys_list_offset = sub_keys_list_offset;
+	walk_frame.element_index        = 0;
+	walk_frame.sub_element_index    = 0;
+
+	do
+	{
+		result = libregf_key_tree_walk_get_next_sub_key_offset(
+		          scheduler->io_handle,
+		          scheduler->file_io_handle,
+		          scheduler->hive_bins_list,
+		          &walk_frame,
+		          &sub_key_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next sub key offset of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 item->key_offset,
+			 item->key_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libregf_walk_scheduler_worker_push_item(
+			     worker,
+			     sub_key_offset,
+			     item->key_offset,
+			     item->depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add sub key item.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_sub_keys++;
+		}
+	}
+	while( result != 0 );
+
+	if( number_of_sub_keys > 0 )
+	{
+		if( libregf_walk_scheduler_signal_items(
+		     scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal items.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Runs a worker
+ * This function is the start function of the thread of the worker
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_worker_run(
+     void *arguments )
+{
+	libregf_walk_scheduler_item_t item;
+
+	libregf_walk_scheduler_worker_t *worker = NULL;
+	static char *function                   = "libregf_walk_scheduler_worker_run";
+	int result                              = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (libregf_walk_scheduler_worker_t *) arguments;
+
+	do
+	{
+		result = libregf_walk_scheduler_get_item(
+		          worker->scheduler,
+		          worker,
+		          &item,
+		          &( worker->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item for worker: %d.",
+			 function,
+			 worker->worker_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libregf_walk_scheduler_walk_item(
+			     worker->scheduler,
+			     worker,
+			     &item,
+			     &( worker->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( worker->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to walk item for worker: %d.",
+				 function,
+				 worker->worker_index );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result != 0 );
+
+	worker->result = 1;
+
+	return( 1 );
+
+on_error:
+	worker->result = -1;
+
+	libregf_walk_scheduler_abort(
+	 worker->scheduler,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Walks the keys of a key tree starting at a specific key using the workers
+ * A scheduler can only be run once
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_walk_scheduler_run(
+     libregf_walk_scheduler_t *scheduler,
+     uint32_t key_offset,
+     libcerror_error_t **error )
+{
+	libregf_walk_scheduler_worker_t *worker = NULL;
+	static char *function                   = "libregf_walk_scheduler_run";
+	int number_of_threads                   = 0;
+	int result                              = 1;
+	int worker_index                        = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scheduler->done != 0 )
+	 || ( scheduler->abort != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scheduler - already run.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_walk_scheduler_worker_push_item(
+	     &( scheduler->workers[ 0 ] ),
+	     key_offset,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add key item.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < scheduler->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( scheduler->workers[ worker_index ] );
+
+		if( libcthreads_thread_create(
+		     &( worker->thread ),
+		     NULL,
+		     &libregf_walk_scheduler_worker_run,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			libregf_walk_scheduler_abort(
+			 scheduler,
+			 NULL );
+
+			result = -1;
+
+			break;
+		}
+		number_of_threads++;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		worker = &( scheduler->workers[ worker_index ] );
+
+		if( libcthreads_thread_join(
+		     &( worker->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < scheduler->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( scheduler->workers[ worker_index ] );
+
+		if( worker->result != 1 )
+		{
+			/* Pass the error of the first worker that failed to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error        = worker->error;
+				worker->error = NULL;
+			}
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk key tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) */
+
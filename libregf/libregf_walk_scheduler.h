@@ -0,0 +1,243 @@
+/*
+ * Walk scheduler functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_WALK_SCHEDULER_H )
+#define _LIBREGF_WALK_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+
+typedef struct libregf_walk_scheduler_item libregf_walk_scheduler_item_t;
+
+struct libregf_walk_scheduler_item
+{
+	/* The offset of the named key
+	 */
+	uint32_t key_offset;
+
+	/* The offset of the named key of the parent key
+	 */
+	uint32_t parent_key_offset;
+
+	/* The depth
+	 */
+	int depth;
+};
+
+typedef struct libregf_walk_scheduler_worker libregf_walk_scheduler_worker_t;
+typedef struct libregf_walk_scheduler libregf_walk_scheduler_t;
+
+struct libregf_walk_scheduler_worker
+{
+	/* The scheduler
+	 */
+	libregf_walk_scheduler_t *scheduler;
+
+	/* The index of the worker
+	 */
+	int worker_index;
+
+	/* The user data passed to the callbacks
+	 */
+	void *user_data;
+
+	/* The items, where the worker takes items from the end
+	 * and other workers take items from the start
+	 */
+	libregf_walk_scheduler_item_t *items;
+
+	/* The index of the first item
+	 */
+	int first_item_index;
+
+	/* The number of items, including the items before the first item index
+	 */
+	int number_of_items;
+
+	/* The number of allocated items
+	 */
+	int number_of_allocated_items;
+
+	/* Value to indicate the walk was aborted
+	 */
+	uint8_t abort;
+
+	/* The mutex, which serializes access to the items
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The result of the worker
+	 */
+	int result;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+};
+
+struct libregf_walk_scheduler
+{
+	/* The IO handle
+	 */
+	libregf_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The hive bins list
+	 */
+	libregf_hive_bins_list_t *hive_bins_list;
+
+	/* The key callback
+	 */
+	int (*key_callback)(
+	       const libregf_walk_key_t *key,
+	       void *user_data );
+
+	/* The value callback
+	 */
+	int (*value_callback)(
+	       const libregf_walk_value_t *value,
+	       void *user_data );
+
+	/* The workers
+	 */
+	libregf_walk_scheduler_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of idle workers
+	 */
+	int number_of_idle_workers;
+
+	/* The generation, which changes every time items are added
+	 */
+	uint32_t generation;
+
+	/* Value to indicate the walk has completed
+	 */
+	uint8_t done;
+
+	/* Value to indicate the walk was aborted
+	 */
+	uint8_t abort;
+
+	/* The mutex, which serializes access to the idle state
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, which is signalled when items are added or the walk has completed
+	 */
+	libcthreads_condition_t *condition;
+};
+
+int libregf_walk_scheduler_initialize(
+     libregf_walk_scheduler_t **scheduler,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     int number_of_workers,
+     int (*key_callback)(
+            const libregf_walk_key_t *key,
+            void *user_data ),
+     int (*value_callback)(
+            const libregf_walk_value_t *value,
+            void *user_data ),
+     void **user_data,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_free(
+     libregf_walk_scheduler_t **scheduler,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_worker_push_item(
+     libregf_walk_scheduler_worker_t *worker,
+     uint32_t key_offset,
+     uint32_t parent_key_offset,
+     int depth,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_worker_pop_item(
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_worker_steal_item(
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_get_item(
+     libregf_walk_scheduler_t *scheduler,
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_signal_items(
+     libregf_walk_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_abort(
+     libregf_walk_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_walk_item(
+     libregf_walk_scheduler_t *scheduler,
+     libregf_walk_scheduler_worker_t *worker,
+     libregf_walk_scheduler_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_walk_scheduler_worker_run(
+     void *arguments );
+
+int libregf_walk_scheduler_run(
+     libregf_walk_scheduler_t *scheduler,
+     uint32_t key_offset,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_WALK_SCHEDULER_H ) */
+
@@ -0,0 +1,103 @@
+/*
+ * The key path index definition of libregf
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REGF_KEY_PATH_INDEX_H )
+#define _REGF_KEY_PATH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct regf_key_path_index_header regf_key_path_index_header_t;
+
+struct regf_key_path_index_header
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 * Contains: "rkpi"
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The primary sequence number of the file the index was created for
+	 * Consists of 4 bytes
+	 */
+	uint8_t primary_sequence_number[ 4 ];
+
+	/* The secondary sequence number of the file the index was created for
+	 * Consists of 4 bytes
+	 */
+	uint8_t secondary_sequence_number[ 4 ];
+
+	/* The hive bins size of the file the index was created for
+	 * Consists of 4 bytes
+	 */
+	uint8_t hive_bins_size[ 4 ];
+
+	/* The file header checksum of the file the index was created for
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+};
+
+typedef struct regf_key_path_index_entry regf_key_path_index_entry_t;
+
+struct regf_key_path_index_entry
+{
+	/* The offset of the key the path is relative to
+	 * Consists of 4 bytes
+	 */
+	uint8_t base_key_offset[ 4 ];
+
+	/* The offset of the key the path resolves to
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_offset[ 4 ];
+
+	/* The path length
+	 * Consists of 4 bytes
+	 * Contains the number of characters
+	 */
+	uint8_t path_length[ 4 ];
+
+	/* The upper case path
+	 * Contains 32-bit little-endian Unicode characters
+	 */
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REGF_KEY_PATH_INDEX_H ) */
+
@@ -31,6 +31,7 @@
 #include "pyregf_error.h"
 #include "pyregf_file.h"
 #include "pyregf_file_object_io_handle.h"
+#include "pyregf_integer.h"
 #include "pyregf_key.h"
 #include "pyregf_libbfio.h"
 #include "pyregf_libcerror.h"
@@ -120,6 +121,20 @@ PyMethodDef pyregf_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the type." },
 
+	{ "get_statistics",
+	  (PyCFunction) pyregf_file_get_statistics,
+	  METH_NOARGS,
+	  "get_statistics() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the cache and I/O statistics." },
+
+	{ "reset_statistics",
+	  (PyCFunction) pyregf_file_reset_statistics,
+	  METH_NOARGS,
+	  "reset_statistics() -> None\n"
+	  "\n"
+	  "Resets the cache and I/O statistics." },
+
 	/* Functions to access the keys */
 
 	{ "get_root_key",
@@ -166,6 +181,12 @@ PyGetSetDef pyregf_file_object_get_set_definitions[] = {
 	  "The type.",
 	  NULL },
 
+	{ "statistics",
+	  (getter) pyregf_file_get_statistics,
+	  (setter) 0,
+	  "The cache and I/O statistics.",
+	  NULL },
+
 	{ "root_key",
 	  (getter) pyregf_file_get_root_key,
 	  (setter) 0,
@@ -1382,6 +1403,183 @@ PyObject *pyregf_file_get_type(
 	return( integer_object );
 }
 
+/* The statistics names
+ */
+static struct pyregf_file_statistic
+{
+	int statistic_type;
+	const char *name;
+} pyregf_file_statistics[] = {
+	{ LIBREGF_STATISTIC_HIVE_BINS_CACHE_HITS, "hive_bins_cache_hits" },
+	{ LIBREGF_STATISTIC_HIVE_BINS_CACHE_MISSES, "hive_bins_cache_misses" },
+	{ LIBREGF_STATISTIC_HIVE_BINS_CACHE_EVICTIONS, "hive_bins_cache_evictions" },
+	{ LIBREGF_STATISTIC_VALUES_CACHE_HITS, "values_cache_hits" },
+	{ LIBREGF_STATISTIC_VALUES_CACHE_MISSES, "values_cache_misses" },
+	{ LIBREGF_STATISTIC_KEYS_CACHE_HITS, "keys_cache_hits" },
+	{ LIBREGF_STATISTIC_KEYS_CACHE_MISSES, "keys_cache_misses" },
+	{ LIBREGF_STATISTIC_NUMBER_OF_CELLS_RESOLVED, "number_of_cells_resolved" },
+	{ LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ, "number_of_bytes_read" },
+	{ LIBREGF_STATISTIC_NUMBER_OF_READ_CALLS, "number_of_read_calls" },
+	{ LIBREGF_STATISTIC_NUMBER_OF_KEYS_MATERIALIZED, "number_of_keys_materialized" },
+	{ LIBREGF_STATISTIC_NUMBER_OF_VALUES_MATERIALIZED, "number_of_values_materialized" },
+	{ 0, NULL }
+};
+
+/* Retrieves the statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyregf_file_get_statistics(
+           pyregf_file_t *pyregf_file,
+           PyObject *arguments PYREGF_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *dictionary_object = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyregf_file_get_statistics";
+	uint64_t value              = 0;
+	int result                  = 0;
+	int statistic_index         = 0;
+
+	PYREGF_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyregf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		goto on_error;
+	}
+	for( statistic_index = 0;
+	     pyregf_file_statistics[ statistic_index ].name != NULL;
+	     statistic_index++ )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libregf_file_get_statistic(
+		          pyregf_file->file,
+		          pyregf_file_statistics[ statistic_index ].statistic_type,
+		          &value,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyregf_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve statistic: %s.",
+			 function,
+			 pyregf_file_statistics[ statistic_index ].name );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		integer_object = pyregf_integer_unsigned_new_from_64bit(
+		                  value );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyDict_SetItemString(
+		     dictionary_object,
+		     pyregf_file_statistics[ statistic_index ].name,
+		     integer_object ) != 0 )
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to set statistic: %s.",
+			 function,
+			 pyregf_file_statistics[ statistic_index ].name );
+
+			goto on_error;
+		}
+		Py_DecRef(
+		 integer_object );
+
+		integer_object = NULL;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
+/* Resets the statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyregf_file_reset_statistics(
+           pyregf_file_t *pyregf_file,
+           PyObject *arguments PYREGF_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyregf_file_reset_statistics";
+	int result               = 0;
+
+	PYREGF_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyregf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libregf_file_reset_statistics(
+	          pyregf_file->file,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyregf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to reset statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Retrieves the root key
  * Returns a Python object if successful or NULL on error
  */
@@ -107,6 +107,14 @@ PyObject *pyregf_file_get_type(
            pyregf_file_t *pyregf_file,
            PyObject *arguments );
 
+PyObject *pyregf_file_get_statistics(
+           pyregf_file_t *pyregf_file,
+           PyObject *arguments );
+
+PyObject *pyregf_file_reset_statistics(
+           pyregf_file_t *pyregf_file,
+           PyObject *arguments );
+
 PyObject *pyregf_file_get_root_key(
            pyregf_file_t *pyregf_file,
            PyObject *arguments );
@@ -1746,3 +1746,81 @@ int info_handle_file_fprint(
 	return( 1 );
 }
 
+/* Prints the cache and I/O statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	struct info_handle_statistic
+	{
+		int statistic_type;
+		const char *description;
+	} statistics[] = {
+		{ LIBREGF_STATISTIC_HIVE_BINS_CACHE_HITS, "Hive bins cache hits:\t\t" },
+		{ LIBREGF_STATISTIC_HIVE_BINS_CACHE_MISSES, "Hive bins cache misses:\t\t" },
+		{ LIBREGF_STATISTIC_HIVE_BINS_CACHE_EVICTIONS, "Hive bins cache evictions:\t" },
+		{ LIBREGF_STATISTIC_VALUES_CACHE_HITS, "Values cache hits:\t\t" },
+		{ LIBREGF_STATISTIC_VALUES_CACHE_MISSES, "Values cache misses:\t\t" },
+		{ LIBREGF_STATISTIC_KEYS_CACHE_HITS, "Keys cache hits:\t\t" },
+		{ LIBREGF_STATISTIC_KEYS_CACHE_MISSES, "Keys cache misses:\t\t" },
+		{ LIBREGF_STATISTIC_NUMBER_OF_CELLS_RESOLVED, "Number of cells resolved:\t" },
+		{ LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ, "Number of bytes read:\t\t" },
+		{ LIBREGF_STATISTIC_NUMBER_OF_READ_CALLS, "Number of read calls:\t\t" },
+		{ LIBREGF_STATISTIC_NUMBER_OF_KEYS_MATERIALIZED, "Number of keys materialized:\t" },
+		{ LIBREGF_STATISTIC_NUMBER_OF_VALUES_MATERIALIZED, "Number of values materialized:\t" },
+	};
+	static char *function    = "info_handle_statistics_fprint";
+	uint64_t value           = 0;
+	int number_of_statistics = (int) ( sizeof( statistics ) / sizeof( struct info_handle_statistic ) );
+	int statistic_index      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	for( statistic_index = 0;
+	     statistic_index < number_of_statistics;
+	     statistic_index++ )
+	{
+		if( libregf_file_get_statistic(
+		     info_handle->input_file,
+		     statistics[ statistic_index ].statistic_type,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistic: %d.",
+			 function,
+			 statistics[ statistic_index ].statistic_type );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t%s%" PRIu64 "\n",
+		 statistics[ statistic_index ].description,
+		 value );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -118,6 +118,7 @@ int main( int argc, char * const argv[] )
 		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
 		{ 'h', NULL, "shows this help" },
 		{ 'H', NULL, "shows the key and value hierarchy" },
+		{ 'S', NULL, "shows the cache and I/O statistics" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source file" },
@@ -132,6 +133,7 @@ int main( int argc, char * const argv[] )
 	system_integer_t option             = 0;
 	int number_of_options               = (int) ( sizeof( options ) / sizeof( regftools_option_t ) );
 	int option_mode                     = REGFINFO_MODE_FILE;
+	int print_statistics                = 0;
 	int result                          = 0;
 	int verbose                         = 0;
 
@@ -230,6 +232,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'S':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -353,6 +360,19 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     regfinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     regfinfo_info_handle,
 	     &error ) != 0 )
@@ -198,6 +198,29 @@ class FileTypeTests(unittest.TestCase):
 
     regf_file.close()
 
+  def test_get_statistics(self):
+    """Tests the get_statistics function and statistics property."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    regf_file = pyregf.file()
+
+    regf_file.open(test_source)
+
+    statistics = regf_file.get_statistics()
+    self.assertIsNotNone(statistics)
+    self.assertIn("number_of_bytes_read", statistics)
+
+    self.assertIsNotNone(regf_file.statistics)
+
+    regf_file.reset_statistics()
+
+    statistics = regf_file.get_statistics()
+    self.assertEqual(statistics["number_of_bytes_read"], 0)
+
+    regf_file.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
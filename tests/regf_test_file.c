@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -190,6 +191,81 @@ int regf_test_file_close_source(
 	return( result );
 }
 
+/* Runs a test function on a separate source file
+ * This is used by tests that freeze the file, since freezing affects the file used by the other tests
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_run_with_separate_file(
+     int (*test_function)(
+            libregf_file_t *file ),
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error = NULL;
+	libregf_file_t *file     = NULL;
+	int result               = 0;
+
+	result = regf_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = test_function(
+	          file );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = regf_test_file_close_source(
+	          &file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libregf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_file_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -598,6 +674,182 @@ on_error:
 	return( 0 );
 }
 
+#if defined( HAVE_MMAP ) || defined( WINAPI )
+
+/* Tests the libregf_file_open function with memory mapped access
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_open_memory_mapped(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libregf_file_t *file     = NULL;
+	libregf_key_t *root_key  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = regf_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_initialize(
+	          &file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libregf_file_open(
+	          file,
+	          narrow_source,
+	          LIBREGF_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the hive bins are read from the mapped data
+	 */
+	result = libregf_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( root_key != NULL )
+	{
+		result = libregf_key_free(
+		          &root_key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test open when already opened
+	 */
+	result = libregf_file_open(
+	          file,
+	          narrow_source,
+	          LIBREGF_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test close
+	 */
+	result = libregf_file_close(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libregf_file_free(
+	          &file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_key != NULL )
+	{
+		libregf_key_free(
+		 &root_key,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libregf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MMAP ) || defined( WINAPI ) */
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Tests the libregf_file_open_wide function
@@ -1002,56 +1254,91 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_file_close function
+/* Tests the libregf_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_file_close(
-     void )
+int regf_test_file_open_memory(
+     libbfio_handle_t *file_io_handle )
 {
 	libcerror_error_t *error = NULL;
+	libregf_file_t *file     = NULL;
+	libregf_key_t *root_key  = NULL;
+	uint8_t *buffer          = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
 	int result               = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libregf_file_close(
-	          NULL,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
 
-	return( 1 );
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libregf_file_open and libregf_file_close functions
- * Returns 1 if successful or 0 if not
- */
-int regf_test_file_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error = NULL;
-	libregf_file_t *file     = NULL;
-	int result               = 0;
+	REGF_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 file_size,
+	 (uint64_t) ( 256 * 1024 * 1024 ) );
+
+	buffer = (uint8_t *) malloc(
+	                      sizeof( uint8_t ) * (size_t) file_size );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libregf_file_initialize(
 	          &file,
 	          &error );
@@ -1069,21 +1356,14 @@ int regf_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libregf_file_open_wide(
-	          file,
-	          source,
-	          LIBREGF_OPEN_READ,
-	          &error );
-#else
-	result = libregf_file_open(
+	result = libregf_file_open_memory(
 	          file,
-	          source,
+	          buffer,
+	          (size_t) file_size,
 	          LIBREGF_OPEN_READ,
 	          &error );
-#endif
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1094,44 +1374,138 @@ int regf_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libregf_file_close(
+	/* Test the hive bins are read from the buffer
+	 */
+	result = libregf_file_get_root_key(
 	          file,
+	          &root_key,
 	          &error );
 
-	REGF_TEST_ASSERT_EQUAL_INT(
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	if( root_key != NULL )
+	{
+		result = libregf_key_free(
+		          &root_key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libregf_file_open_wide(
+	result = libregf_file_open_memory(
+	          NULL,
+	          buffer,
+	          (size_t) file_size,
+	          LIBREGF_OPEN_READ,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_open_memory(
 	          file,
-	          source,
+	          NULL,
+	          (size_t) file_size,
 	          LIBREGF_OPEN_READ,
 	          &error );
-#else
-	result = libregf_file_open(
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_open_memory(
 	          file,
-	          source,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
 	          LIBREGF_OPEN_READ,
 	          &error );
-#endif
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) file_size,
+	          LIBREGF_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libregf_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) file_size,
+	          LIBREGF_OPEN_READ,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libregf_file_close(
 	          file,
 	          &error );
@@ -1145,8 +1519,6 @@ int regf_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
 	result = libregf_file_free(
 	          &file,
 	          &error );
@@ -1164,6 +1536,9 @@ int regf_test_file_open_close(
 	 "error",
 	 error );
 
+	free(
+	 buffer );
+
 	return( 1 );
 
 on_error:
@@ -1172,42 +1547,38 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( root_key != NULL )
+	{
+		libregf_key_free(
+		 &root_key,
+		 NULL );
+	}
 	if( file != NULL )
 	{
 		libregf_file_free(
 		 &file,
 		 NULL );
 	}
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
 	return( 0 );
 }
 
-/* Tests the libregf_file_signal_abort function
+/* Tests the libregf_file_close function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_file_signal_abort(
-     libregf_file_t *file )
+int regf_test_file_close(
+     void )
 {
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
-	/* Test regular cases
-	 */
-	result = libregf_file_signal_abort(
-	          file,
-	          &error );
-
-	REGF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	REGF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	/* Test error cases
 	 */
-	result = libregf_file_signal_abort(
+	result = libregf_file_close(
 	          NULL,
 	          &error );
 
@@ -1234,80 +1605,274 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_file_is_corrupted function
+/* Tests the libregf_file_open and libregf_file_close functions
  * Returns 1 if successful or 0 if not
  */
-int regf_test_file_is_corrupted(
-     libregf_file_t *file )
+int regf_test_file_open_close(
+     const system_character_t *source )
 {
 	libcerror_error_t *error = NULL;
+	libregf_file_t *file     = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libregf_file_is_corrupted(
-	          file,
+	result = libregf_file_initialize(
+	          &file,
 	          &error );
 
-	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open and close
 	 */
-	result = libregf_file_is_corrupted(
-	          NULL,
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_file_open_wide(
+	          file,
+	          source,
+	          LIBREGF_OPEN_READ,
+	          &error );
+#else
+	result = libregf_file_open(
+	          file,
+	          source,
+	          LIBREGF_OPEN_READ,
 	          &error );
+#endif
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libregf_file_get_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int regf_test_file_get_ascii_codepage(
-     libregf_file_t *file )
-{
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int result                = 0;
-
-	/* Test regular cases
-	 */
-	result = libregf_file_get_ascii_codepage(
+	result = libregf_file_close(
 	          file,
-	          &ascii_codepage,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_file_open_wide(
+	          file,
+	          source,
+	          LIBREGF_OPEN_READ,
+	          &error );
+#else
+	result = libregf_file_open(
+	          file,
+	          source,
+	          LIBREGF_OPEN_READ,
+	          &error );
+#endif
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_close(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libregf_file_free(
+	          &file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libregf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_signal_abort(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_signal_abort(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_signal_abort(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_is_corrupted function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_is_corrupted(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_is_corrupted(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_is_corrupted(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_ascii_codepage(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1498,40 +2063,1940 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_file_get_format_version function
+/* Tests the libregf_file_get_maximum_number_of_cached_hive_bins function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_file_get_format_version(
+int regf_test_file_get_maximum_number_of_cached_hive_bins(
      libregf_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t major_version   = 0;
-	uint32_t minor_version   = 0;
-	int result               = 0;
+	libcerror_error_t *error               = NULL;
+	int maximum_number_of_cached_hive_bins = 0;
+	int result                             = 0;
 
 	/* Test regular cases
 	 */
-	result = libregf_file_get_format_version(
+	result = libregf_file_get_maximum_number_of_cached_hive_bins(
+	          file,
+	          &maximum_number_of_cached_hive_bins,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_number_of_cached_hive_bins",
+	 maximum_number_of_cached_hive_bins,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_maximum_number_of_cached_hive_bins(
+	          NULL,
+	          &maximum_number_of_cached_hive_bins,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_maximum_number_of_cached_hive_bins(
+	          file,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_set_maximum_number_of_cached_hive_bins function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_set_maximum_number_of_cached_hive_bins(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error               = NULL;
+	int maximum_number_of_cached_hive_bins = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_file_get_maximum_number_of_cached_hive_bins(
+	          file,
+	          &maximum_number_of_cached_hive_bins,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_file_set_maximum_number_of_cached_hive_bins(
+	          file,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_set_maximum_number_of_cached_hive_bins(
+	          NULL,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_set_maximum_number_of_cached_hive_bins(
+	          file,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_file_set_maximum_number_of_cached_hive_bins(
+	          file,
+	          maximum_number_of_cached_hive_bins,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_maximum_number_of_cached_values function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_maximum_number_of_cached_values(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error            = NULL;
+	int maximum_number_of_cached_values = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_maximum_number_of_cached_values(
+	          file,
+	          &maximum_number_of_cached_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_number_of_cached_values",
+	 maximum_number_of_cached_values,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_maximum_number_of_cached_values(
+	          NULL,
+	          &maximum_number_of_cached_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_maximum_number_of_cached_values(
+	          file,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_set_maximum_number_of_cached_values function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_set_maximum_number_of_cached_values(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error            = NULL;
+	int maximum_number_of_cached_values = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_file_get_maximum_number_of_cached_values(
+	          file,
+	          &maximum_number_of_cached_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_file_set_maximum_number_of_cached_values(
+	          file,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_set_maximum_number_of_cached_values(
+	          NULL,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_set_maximum_number_of_cached_values(
+	          file,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_file_set_maximum_number_of_cached_values(
+	          file,
+	          maximum_number_of_cached_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_statistic function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_statistic(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_statistic(
+	          file,
+	          LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_statistic(
+	          NULL,
+	          LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_statistic(
+	          file,
+	          0,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_statistic(
+	          file,
+	          LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_reset_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_reset_statistics(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_reset_statistics(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_get_statistic(
+	          file,
+	          LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_reset_statistics(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_freeze function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_freeze(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libregf_key_t *root_key  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_freeze(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Freezing a frozen file has no effect
+	 */
+	result = libregf_file_freeze(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = libregf_key_free(
+		          &root_key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libregf_file_freeze(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_key != NULL )
+	{
+		libregf_key_free(
+		 &root_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_format_version function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_format_version(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t major_version   = 0;
+	uint32_t minor_version   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_format_version(
+	          file,
+	          &major_version,
+	          &minor_version,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_format_version(
+	          NULL,
+	          &major_version,
+	          &minor_version,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_format_version(
+	          file,
+	          NULL,
+	          &minor_version,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_format_version(
+	          file,
+	          &major_version,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_type(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_type(
+	          file,
+	          &type,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_type(
+	          file,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_root_key function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_root_key(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libregf_key_t *root_key  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		REGF_TEST_ASSERT_IS_NOT_NULL(
+		 "root_key",
+		 root_key );
+
+		result = libregf_key_free(
+		          &root_key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libregf_file_get_root_key(
+	          NULL,
+	          &root_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "root_key",
+	 root_key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_root_key(
+	          file,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "root_key",
+	 root_key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_key_by_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_key_by_utf8_path(
+     libregf_file_t *file )
+{
+	uint8_t utf8_key_path[ 7 ] = { 'S', 'e', 'l', 'e', 'c', 't', 0 };
+	libcerror_error_t *error   = NULL;
+	libregf_key_t *key         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_key_by_utf8_path(
+	          file,
+	          utf8_key_path,
+	          6,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		REGF_TEST_ASSERT_IS_NOT_NULL(
+		 "key",
+		 key );
+
+		result = libregf_key_free(
+		          &key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libregf_file_get_key_by_utf8_path(
+	          NULL,
+	          utf8_key_path,
+	          6,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_key_by_utf8_path(
+	          file,
+	          NULL,
+	          6,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_key_by_utf8_path(
+	          file,
+	          utf8_key_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_key_by_utf8_path(
+	          file,
+	          utf8_key_path,
+	          6,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Key callback for the walk tests that counts the keys
+ * Returns 1 to continue
+ */
+int regf_test_file_walk_key_callback(
+     const libregf_walk_key_t *key,
+     void *user_data )
+{
+	int *number_of_keys = (int *) user_data;
+
+	if( ( key == NULL )
+	 || ( number_of_keys == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( key->depth == 0 )
+	 && ( key->parent_offset != 0 ) )
+	{
+		return( -1 );
+	}
+	*number_of_keys += 1;
+
+	return( 1 );
+}
+
+/* Key callback for the walk tests that fails
+ * Returns -1
+ */
+int regf_test_file_walk_key_callback_error(
+     const libregf_walk_key_t *key REGF_TEST_ATTRIBUTE_UNUSED,
+     void *user_data REGF_TEST_ATTRIBUTE_UNUSED )
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( key )
+	REGF_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( -1 );
+}
+
+/* Value callback for the walk tests that checks the value
+ * Returns 1 to continue or -1 on error
+ */
+int regf_test_file_walk_value_callback(
+     const libregf_walk_value_t *value,
+     void *user_data REGF_TEST_ATTRIBUTE_UNUSED )
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	if( ( value->name_size > 0 )
+	 && ( value->name == NULL ) )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libregf_file_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_walk(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_keys       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          &number_of_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_keys",
+	 number_of_keys,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libregf_file_walk(
+	          NULL,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          &number_of_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk(
+	          file,
+	          NULL,
+	          &regf_test_file_walk_value_callback,
+	          &number_of_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_walk_key_callback_error,
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_walk_parallel function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_walk_parallel(
+     libregf_file_t *file )
+{
+	int number_of_keys_per_thread[ 4 ] = { 0, 0, 0, 0 };
+	void *user_data[ 4 ]                = { NULL, NULL, NULL, NULL };
+
+	libcerror_error_t *error            = NULL;
+	int number_of_keys                  = 0;
+	int number_of_walked_keys           = 0;
+	int result                          = 0;
+	int thread_index                    = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		user_data[ thread_index ] = &( number_of_keys_per_thread[ thread_index ] );
+	}
+	/* Test regular cases
+	 */
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_walk_key_callback,
+	          NULL,
+	          &number_of_walked_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_freeze(
+	          file,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_walk_parallel(
+	          file,
+	          4,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          user_data,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		number_of_keys += number_of_keys_per_thread[ thread_index ];
+	}
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_keys",
+	 number_of_keys,
+	 number_of_walked_keys );
+
+	/* Test error cases
+	 */
+	result = libregf_file_walk_parallel(
+	          NULL,
+	          4,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          user_data,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk_parallel(
+	          file,
+	          0,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          user_data,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk_parallel(
+	          file,
+	          4,
+	          NULL,
+	          &regf_test_file_walk_value_callback,
+	          user_data,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk_parallel(
+	          file,
+	          4,
+	          &regf_test_file_walk_key_callback_error,
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* A key of the scan tests
+ */
+typedef struct regf_test_file_scan_key regf_test_file_scan_key_t;
+
+struct regf_test_file_scan_key
+{
+	/* The offset of the named key
+	 */
+	uint32_t offset;
+
+	/* The offset of the named key of the parent key
+	 */
+	uint32_t parent_offset;
+
+	/* The depth
+	 */
+	int depth;
+
+	/* The name
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* Value to indicate the key was found by the scan
+	 */
+	uint8_t is_scanned;
+};
+
+/* The keys of the scan tests
+ */
+typedef struct regf_test_file_scan_keys regf_test_file_scan_keys_t;
+
+struct regf_test_file_scan_keys
+{
+	/* The keys
+	 */
+	regf_test_file_scan_key_t *keys;
+
+	/* The number of keys
+	 */
+	int number_of_keys;
+
+	/* The number of allocated keys
+	 */
+	int number_of_allocated_keys;
+
+	/* The number of walked keys found by the scan
+	 */
+	int number_of_scanned_keys;
+};
+
+/* Frees the keys of the scan tests
+ */
+void regf_test_file_scan_keys_free(
+      regf_test_file_scan_keys_t *scan_keys )
+{
+	int key_index = 0;
+
+	if( scan_keys->keys != NULL )
+	{
+		for( key_index = 0;
+		     key_index < scan_keys->number_of_keys;
+		     key_index++ )
+		{
+			if( scan_keys->keys[ key_index ].name != NULL )
+			{
+				memory_free(
+				 scan_keys->keys[ key_index ].name );
+			}
+		}
+		memory_free(
+		 scan_keys->keys );
+
+		scan_keys->keys = NULL;
+	}
+	scan_keys->number_of_keys           = 0;
+	scan_keys->number_of_allocated_keys = 0;
+	scan_keys->number_of_scanned_keys   = 0;
+}
+
+/* Compares the offsets of two keys of the scan tests
+ * Returns -1, 0 or 1
+ */
+int regf_test_file_scan_key_compare(
+     const void *first_key,
+     const void *second_key )
+{
+	uint32_t first_offset  = ( (const regf_test_file_scan_key_t *) first_key )->offset;
+	uint32_t second_offset = ( (const regf_test_file_scan_key_t *) second_key )->offset;
+
+	if( first_offset < second_offset )
+	{
+		return( -1 );
+	}
+	else if( first_offset > second_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Key callback for the scan tests that stores the walked keys
+ * Returns 1 to continue or -1 on error
+ */
+int regf_test_file_scan_walk_key_callback(
+     const libregf_walk_key_t *key,
+     void *user_data )
+{
+	regf_test_file_scan_key_t *scan_key   = NULL;
+	regf_test_file_scan_keys_t *scan_keys = (regf_test_file_scan_keys_t *) user_data;
+	void *reallocation                    = NULL;
+
+	if( ( key == NULL )
+	 || ( scan_keys == NULL ) )
+	{
+		return( -1 );
+	}
+	if( scan_keys->number_of_keys >= scan_keys->number_of_allocated_keys )
+	{
+		reallocation = memory_reallocate(
+		                scan_keys->keys,
+		                sizeof( regf_test_file_scan_key_t ) * ( scan_keys->number_of_allocated_keys + 1024 ) );
+
+		if( reallocation == NULL )
+		{
+			return( -1 );
+		}
+		scan_keys->keys                      = (regf_test_file_scan_key_t *) reallocation;
+		scan_keys->number_of_allocated_keys += 1024;
+	}
+	scan_key = &( scan_keys->keys[ scan_keys->number_of_keys ] );
+
+	scan_key->offset        = key->offset;
+	scan_key->parent_offset = key->parent_offset;
+	scan_key->depth         = key->depth;
+	scan_key->name          = NULL;
+	scan_key->name_size     = key->name_size;
+	scan_key->is_scanned    = 0;
+
+	if( key->name_size > 0 )
+	{
+		scan_key->name = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * key->name_size );
+
+		if( scan_key->name == NULL )
+		{
+			return( -1 );
+		}
+		if( memory_copy(
+		     scan_key->name,
+		     key->name,
+		     key->name_size ) == NULL )
+		{
+			memory_free(
+			 scan_key->name );
+
+			return( -1 );
+		}
+	}
+	scan_keys->number_of_keys += 1;
+
+	return( 1 );
+}
+
+/* Key callback for the scan tests that checks the scanned keys against the walked keys
+ * Returns 1 to continue or -1 on error
+ */
+int regf_test_file_scan_key_callback(
+     const libregf_walk_key_t *key,
+     void *user_data )
+{
+	regf_test_file_scan_key_t search_key;
+
+	regf_test_file_scan_key_t *scan_key   = NULL;
+	regf_test_file_scan_keys_t *scan_keys = (regf_test_file_scan_keys_t *) user_data;
+
+	if( ( key == NULL )
+	 || ( scan_keys == NULL ) )
+	{
+		return( -1 );
+	}
+	if( key->depth != -1 )
+	{
+		return( -1 );
+	}
+	if( ( key->name_size > 0 )
+	 && ( key->name == NULL ) )
+	{
+		return( -1 );
+	}
+	search_key.offset = key->offset;
+
+	scan_key = (regf_test_file_scan_key_t *) bsearch(
+	                                          &search_key,
+	                                          scan_keys->keys,
+	                                          (size_t) scan_keys->number_of_keys,
+	                                          sizeof( regf_test_file_scan_key_t ),
+	                                          &regf_test_file_scan_key_compare );
+
+	/* The scan also returns allocated keys that are not part of the key tree
+	 */
+	if( scan_key == NULL )
+	{
+		return( 1 );
+	}
+	if( scan_key->is_scanned != 0 )
+	{
+		return( -1 );
+	}
+	if( scan_key->name_size != key->name_size )
+	{
+		return( -1 );
+	}
+	if( ( key->name_size > 0 )
+	 && ( memory_compare(
+	       scan_key->name,
+	       key->name,
+	       key->name_size ) != 0 ) )
+	{
+		return( -1 );
+	}
+	/* The parent offset of the root key is not known by the walk
+	 */
+	if( ( scan_key->depth > 0 )
+	 && ( scan_key->parent_offset != key->parent_offset ) )
+	{
+		return( -1 );
+	}
+	scan_key->is_scanned = 1;
+
+	scan_keys->number_of_scanned_keys += 1;
+
+	return( 1 );
+}
+
+/* Tests the libregf_file_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_scan(
+     libregf_file_t *file )
+{
+	regf_test_file_scan_keys_t scan_keys;
+
+	libcerror_error_t *error  = NULL;
+	int number_of_keys        = 0;
+	int number_of_walked_keys = 0;
+	int result                = 0;
+
+	scan_keys.keys                     = NULL;
+	scan_keys.number_of_keys           = 0;
+	scan_keys.number_of_allocated_keys = 0;
+	scan_keys.number_of_scanned_keys   = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_walk_key_callback,
+	          NULL,
+	          &number_of_walked_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_scan(
+	          file,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          &number_of_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan also returns allocated keys that are not part of the key tree
+	 */
+	REGF_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_keys",
+	 number_of_keys,
+	 number_of_walked_keys - 1 );
+
+	/* Test if every walked key is scanned with the same offset, name and parent offset
+	 */
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_scan_walk_key_callback,
+	          NULL,
+	          &scan_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "scan_keys.number_of_keys",
+	 scan_keys.number_of_keys,
+	 number_of_walked_keys );
+
+	qsort(
+	 scan_keys.keys,
+	 (size_t) scan_keys.number_of_keys,
+	 sizeof( regf_test_file_scan_key_t ),
+	 &regf_test_file_scan_key_compare );
+
+	result = libregf_file_scan(
+	          file,
+	          &regf_test_file_scan_key_callback,
+	          NULL,
+	          &scan_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "scan_keys.number_of_scanned_keys",
+	 scan_keys.number_of_scanned_keys,
+	 number_of_walked_keys );
+
+	regf_test_file_scan_keys_free(
+	 &scan_keys );
+
+	/* Test error cases
+	 */
+	result = libregf_file_scan(
+	          NULL,
+	          &regf_test_file_walk_key_callback,
+	          &regf_test_file_walk_value_callback,
+	          &number_of_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_scan(
+	          file,
+	          NULL,
+	          &regf_test_file_walk_value_callback,
+	          &number_of_keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_scan(
+	          file,
+	          &regf_test_file_walk_key_callback_error,
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	regf_test_file_scan_keys_free(
+	 &scan_keys );
+
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_key_path_index_size, libregf_file_copy_key_path_index
+ * and libregf_file_set_key_path_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_key_path_index(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *index_data      = NULL;
+	size_t index_data_size   = 0;
+	uint8_t byte_value       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_key_path_index_size(
+	          file,
+	          &index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * index_data_size );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_data",
+	 index_data );
+
+	result = libregf_file_copy_key_path_index(
+	          file,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_set_key_path_index(
+	          file,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an index of another file is rejected
+	 * The file header checksum of the index is stored at offset 20
+	 */
+	byte_value        = index_data[ 20 ];
+	index_data[ 20 ] ^= 0xff;
+
+	result = libregf_file_set_key_path_index(
+	          file,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_data[ 20 ] = byte_value;
+
+	/* Test that an index of another state of the file is rejected
+	 * The secondary sequence number of the index is stored at offset 12
+	 */
+	byte_value        = index_data[ 12 ];
+	index_data[ 12 ] ^= 0xff;
+
+	result = libregf_file_set_key_path_index(
 	          file,
-	          &major_version,
-	          &minor_version,
+	          index_data,
+	          index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	index_data[ 12 ] = byte_value;
+
+	/* Test that a truncated index is rejected
 	 */
-	result = libregf_file_get_format_version(
-	          NULL,
-	          &major_version,
-	          &minor_version,
+	result = libregf_file_set_key_path_index(
+	          file,
+	          index_data,
+	          index_data_size - 1,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1546,10 +4011,16 @@ int regf_test_file_get_format_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_format_version(
+	/* Test that a corrupted index is rejected
+	 * The number of entries of the index is stored at offset 24
+	 */
+	byte_value        = index_data[ 27 ];
+	index_data[ 27 ] ^= 0xff;
+
+	result = libregf_file_set_key_path_index(
 	          file,
-	          NULL,
-	          &minor_version,
+	          index_data,
+	          index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1564,10 +4035,15 @@ int regf_test_file_get_format_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_format_version(
+	index_data[ 27 ] = byte_value;
+
+	byte_value       = index_data[ 0 ];
+	index_data[ 0 ] ^= 0xff;
+
+	result = libregf_file_set_key_path_index(
 	          file,
-	          &major_version,
-	          NULL,
+	          index_data,
+	          index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1582,32 +4058,14 @@ int regf_test_file_get_format_version(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libregf_file_get_type function
- * Returns 1 if successful or 0 if not
- */
-int regf_test_file_get_type(
-     libregf_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t type            = 0;
-	int result               = 0;
+	index_data[ 0 ] = byte_value;
 
-	/* Test regular cases
+	/* Test that the index can still be set after it was rejected
 	 */
-	result = libregf_file_get_type(
+	result = libregf_file_set_key_path_index(
 	          file,
-	          &type,
+	          index_data,
+	          index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1621,9 +4079,9 @@ int regf_test_file_get_type(
 
 	/* Test error cases
 	 */
-	result = libregf_file_get_type(
+	result = libregf_file_get_key_path_index_size(
 	          NULL,
-	          &type,
+	          &index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1638,7 +4096,7 @@ int regf_test_file_get_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_type(
+	result = libregf_file_get_key_path_index_size(
 	          file,
 	          NULL,
 	          &error );
@@ -1655,67 +4113,46 @@ int regf_test_file_get_type(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libregf_file_copy_key_path_index(
+	          NULL,
+	          index_data,
+	          index_data_size,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libregf_file_get_root_key function
- * Returns 1 if successful or 0 if not
- */
-int regf_test_file_get_root_key(
-     libregf_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	libregf_key_t *root_key  = 0;
-	int result               = 0;
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libregf_file_get_root_key(
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_copy_key_path_index(
 	          file,
-	          &root_key,
+	          NULL,
+	          index_data_size,
 	          &error );
 
-	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
+	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	if( result != 0 )
-	{
-		REGF_TEST_ASSERT_IS_NOT_NULL(
-		 "root_key",
-		 root_key );
-
-		result = libregf_key_free(
-		          &root_key,
-		          &error );
-
-		REGF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	libcerror_error_free(
+	 &error );
 
-		REGF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
-	 */
-	result = libregf_file_get_root_key(
+	result = libregf_file_set_key_path_index(
 	          NULL,
-	          &root_key,
+	          index_data,
+	          index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1723,10 +4160,6 @@ int regf_test_file_get_root_key(
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
-	 "root_key",
-	 root_key );
-
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1734,9 +4167,10 @@ int regf_test_file_get_root_key(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_root_key(
+	result = libregf_file_set_key_path_index(
 	          file,
 	          NULL,
+	          index_data_size,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1744,10 +4178,6 @@ int regf_test_file_get_root_key(
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
-	 "root_key",
-	 root_key );
-
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1755,6 +4185,11 @@ int regf_test_file_get_root_key(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	memory_free(
+	 index_data );
+
 	return( 1 );
 
 on_error:
@@ -1763,64 +4198,85 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
 	return( 0 );
 }
 
-/* Tests the libregf_file_get_key_by_utf8_path function
+/* Tests the libregf_file_get_keys_by_utf8_paths function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_file_get_key_by_utf8_path(
+int regf_test_file_get_keys_by_utf8_paths(
      libregf_file_t *file )
 {
-	uint8_t utf8_key_path[ 7 ] = { 'S', 'e', 'l', 'e', 'c', 't', 0 };
-	libcerror_error_t *error   = NULL;
-	libregf_key_t *key         = 0;
-	int result                 = 0;
+	uint8_t utf8_key_path1[ 7 ]      = { 'S', 'e', 'l', 'e', 'c', 't', 0 };
+	uint8_t utf8_key_path2[ 8 ]      = { '\\', 's', 'E', 'L', 'E', 'C', 'T', 0 };
+	uint8_t utf8_key_path3[ 12 ]     = { 'S', 'e', 'l', 'e', 'c', 't', '\\', 'B', 'o', 'g', 'u', 's' };
+	const uint8_t *utf8_strings[ 4 ] = { utf8_key_path3, utf8_key_path1, utf8_key_path2, utf8_key_path1 };
+	size_t utf8_string_lengths[ 4 ]  = { 12, 6, 7, 0 };
+	libregf_key_t *keys[ 4 ]         = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error         = NULL;
+	int key_index                    = 0;
+	int result                       = 0;
 
 	/* Test regular cases
 	 */
-	result = libregf_file_get_key_by_utf8_path(
+	result = libregf_file_get_keys_by_utf8_paths(
 	          file,
-	          utf8_key_path,
-	          6,
-	          &key,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          4,
+	          keys,
 	          &error );
 
-	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( result != 0 )
+	/* Paths that only differ in case or a leading separator resolve to the same key
+	 */
+	if( keys[ 1 ] != NULL )
 	{
 		REGF_TEST_ASSERT_IS_NOT_NULL(
-		 "key",
-		 key );
-
-		result = libregf_key_free(
-		          &key,
-		          &error );
+		 "keys[ 2 ]",
+		 keys[ 2 ] );
+	}
+	for( key_index = 0;
+	     key_index < 4;
+	     key_index++ )
+	{
+		if( keys[ key_index ] != NULL )
+		{
+			result = libregf_key_free(
+			          &( keys[ key_index ] ),
+			          &error );
 
-		REGF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-		REGF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+			REGF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
 	}
 	/* Test error cases
 	 */
-	result = libregf_file_get_key_by_utf8_path(
+	result = libregf_file_get_keys_by_utf8_paths(
 	          NULL,
-	          utf8_key_path,
-	          6,
-	          &key,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          4,
+	          keys,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1828,10 +4284,6 @@ int regf_test_file_get_key_by_utf8_path(
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
-	 "key",
-	 key );
-
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1839,11 +4291,12 @@ int regf_test_file_get_key_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_key_by_utf8_path(
+	result = libregf_file_get_keys_by_utf8_paths(
 	          file,
 	          NULL,
-	          6,
-	          &key,
+	          utf8_string_lengths,
+	          4,
+	          keys,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1851,10 +4304,6 @@ int regf_test_file_get_key_by_utf8_path(
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
-	 "key",
-	 key );
-
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1862,11 +4311,12 @@ int regf_test_file_get_key_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_key_by_utf8_path(
+	result = libregf_file_get_keys_by_utf8_paths(
 	          file,
-	          utf8_key_path,
-	          (size_t) SSIZE_MAX + 1,
-	          &key,
+	          utf8_strings,
+	          NULL,
+	          4,
+	          keys,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1874,9 +4324,25 @@ int regf_test_file_get_key_by_utf8_path(
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
-	 "key",
-	 key );
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_keys_by_utf8_paths(
+	          file,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          0,
+	          keys,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1885,10 +4351,11 @@ int regf_test_file_get_key_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_file_get_key_by_utf8_path(
+	result = libregf_file_get_keys_by_utf8_paths(
 	          file,
-	          utf8_key_path,
-	          6,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          4,
 	          NULL,
 	          &error );
 
@@ -1897,10 +4364,6 @@ int regf_test_file_get_key_by_utf8_path(
 	 result,
 	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
-	 "key",
-	 key );
-
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1916,6 +4379,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	for( key_index = 0;
+	     key_index < 4;
+	     key_index++ )
+	{
+		if( keys[ key_index ] != NULL )
+		{
+			libregf_key_free(
+			 &( keys[ key_index ] ),
+			 NULL );
+		}
+	}
 	return( 0 );
 }
 
@@ -2194,6 +4668,15 @@ int main(
 		 regf_test_file_open,
 		 source );
 
+#if defined( HAVE_MMAP ) || defined( WINAPI )
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_open (memory mapped)",
+		 regf_test_file_open_memory_mapped,
+		 source );
+
+#endif /* defined( HAVE_MMAP ) || defined( WINAPI ) */
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 		REGF_TEST_RUN_WITH_ARGS(
@@ -2208,6 +4691,11 @@ int main(
 		 regf_test_file_open_file_io_handle,
 		 source );
 
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_open_memory",
+		 regf_test_file_open_memory,
+		 file_io_handle );
+
 		REGF_TEST_RUN(
 		 "libregf_file_close",
 		 regf_test_file_close );
@@ -2263,6 +4751,42 @@ int main(
 		 regf_test_file_set_ascii_codepage,
 		 file );
 
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_get_maximum_number_of_cached_hive_bins",
+		 regf_test_file_get_maximum_number_of_cached_hive_bins,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_set_maximum_number_of_cached_hive_bins",
+		 regf_test_file_set_maximum_number_of_cached_hive_bins,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_get_maximum_number_of_cached_values",
+		 regf_test_file_get_maximum_number_of_cached_values,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_set_maximum_number_of_cached_values",
+		 regf_test_file_set_maximum_number_of_cached_values,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_get_statistic",
+		 regf_test_file_get_statistic,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_reset_statistics",
+		 regf_test_file_reset_statistics,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_freeze",
+		 regf_test_file_run_with_separate_file,
+		 regf_test_file_freeze,
+		 file_io_handle );
+
 		REGF_TEST_RUN_WITH_ARGS(
 		 "libregf_file_get_format_version",
 		 regf_test_file_get_format_version,
@@ -2283,6 +4807,32 @@ int main(
 		 regf_test_file_get_key_by_utf8_path,
 		 file );
 
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_walk",
+		 regf_test_file_walk,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_walk_parallel",
+		 regf_test_file_run_with_separate_file,
+		 regf_test_file_walk_parallel,
+		 file_io_handle );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_scan",
+		 regf_test_file_scan,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_key_path_index",
+		 regf_test_file_key_path_index,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_get_keys_by_utf8_paths",
+		 regf_test_file_get_keys_by_utf8_paths,
+		 file );
+
 		REGF_TEST_RUN_WITH_ARGS(
 		 "libregf_file_get_key_by_utf16_path",
 		 regf_test_file_get_key_by_utf16_path,
@@ -699,6 +699,882 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_hive_bin_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bin_set_data(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libregf_hive_bin_t *hive_bin = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hive_bin_initialize(
+	          &hive_bin,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bin_set_data(
+	          NULL,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bin_set_data(
+	          hive_bin,
+	          NULL,
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bin_set_data(
+	          hive_bin,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bin_set_data(
+	          hive_bin,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin->data",
+	 hive_bin->data );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->data_is_referenced",
+	 hive_bin->data_is_referenced,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test hive bin data already set
+	 */
+	result = libregf_hive_bin_set_data(
+	          hive_bin,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up, the referenced data is not freed
+	 */
+	result = libregf_hive_bin_free(
+	          &hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &hive_bin,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bin_read_data_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bin_read_data_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libregf_hive_bin_t *hive_bin     = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hive_bin_initialize(
+	          &hive_bin,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bin_read_data_file_io_handle(
+	          hive_bin,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin->data",
+	 hive_bin->data );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "hive_bin->data_size",
+	 hive_bin->data_size,
+	 (size_t) ( 4096 - 32 ) );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->cells_read",
+	 hive_bin->cells_read,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bin_read_data_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test hive bin data already set
+	 */
+	result = libregf_hive_bin_read_data_file_io_handle(
+	          hive_bin,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bin_free(
+	          &hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &hive_bin,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bin_read_cell_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bin_read_cell_at_offset(
+     void )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t *error               = NULL;
+	libregf_hive_bin_t *hive_bin           = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
+	uint16_t number_of_cells               = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hive_bin_initialize(
+	          &hive_bin,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_read_data_file_io_handle(
+	          hive_bin,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bin_read_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 144,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 + 144 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cell read on demand is retrieved by offset
+	 */
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 ) );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.size",
+	 hive_bin_cell.size,
+	 (uint32_t) ( 144 - 4 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offset that is not aligned to 8 bytes
+	 */
+	result = libregf_hive_bin_read_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 4,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offset that is aligned to 8 bytes but inside a cell
+	 */
+	result = libregf_hive_bin_read_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 8,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that all the cells are read when the number of cells is requested
+	 */
+	result = libregf_hive_bin_get_number_of_cells(
+	          hive_bin,
+	          &number_of_cells,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->cells_read",
+	 hive_bin->cells_read,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bin_read_cell_at_offset(
+	          NULL,
+	          4096 + 32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bin_read_cell_at_offset(
+	          hive_bin,
+	          4096 + 32,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bin_free(
+	          &hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &hive_bin,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bin_get_cell_at_offset function reads the cells table once
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bin_get_cell_at_offset_cells_table(
+     void )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t *error               = NULL;
+	libregf_hive_bin_t *hive_bin           = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
+	uint32_t *cell_offsets                 = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hive_bin_initialize(
+	          &hive_bin,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          &( regf_test_hive_bin_data1[ 32 ] ),
+	          4096 - 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_read_data_file_io_handle(
+	          hive_bin,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->cells_read",
+	 hive_bin->cells_read,
+	 0 );
+
+	/* Test that the first lookup reads the cells table
+	 */
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 144,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 + 144 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->cells_read",
+	 hive_bin->cells_read,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin->cell_offsets",
+	 hive_bin->cell_offsets );
+
+	cell_offsets = hive_bin->cell_offsets;
+
+	/* Test that subsequent lookups do not follow the cell boundaries again,
+	 * which would fail on the invalid size of the first cell
+	 */
+	hive_bin->data[ 0 ] = 0x00;
+	hive_bin->data[ 1 ] = 0x00;
+	hive_bin->data[ 2 ] = 0x00;
+	hive_bin->data[ 3 ] = 0x80;
+
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 144,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 + 144 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 8,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin->cell_offsets == cell_offsets",
+	 (int) ( hive_bin->cell_offsets == cell_offsets ),
+	 1 );
+
+	/* Test that the cells of a hive bin with a corrupted cells table are read on demand
+	 */
+	hive_bin->data[ 144 ] = 0x00;
+	hive_bin->data[ 145 ] = 0x00;
+	hive_bin->data[ 146 ] = 0x00;
+	hive_bin->data[ 147 ] = 0x80;
+
+	hive_bin->data[ 0 ] = 0x70;
+	hive_bin->data[ 1 ] = 0xff;
+	hive_bin->data[ 2 ] = 0xff;
+	hive_bin->data[ 3 ] = 0xff;
+
+	hive_bin->cells_read = 0;
+
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->cells_read",
+	 hive_bin->cells_read,
+	 0 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin->cells_table_is_corrupted",
+	 hive_bin->cells_table_is_corrupted,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin->cell_offsets",
+	 hive_bin->cell_offsets );
+
+	/* Clean up
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_free(
+	          &hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &hive_bin,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_hive_bin_read_cells_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -757,6 +1633,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          hive_bin,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -773,6 +1650,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          NULL,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -790,6 +1668,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          hive_bin,
 	          NULL,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -843,6 +1722,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          hive_bin,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -997,7 +1877,7 @@ int regf_test_hive_bin_get_cell(
      libregf_hive_bin_t *hive_bin )
 {
 	libcerror_error_t *error               = NULL;
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
 	int result                             = 0;
 
 	/* Test regular cases
@@ -1013,9 +1893,10 @@ int regf_test_hive_bin_get_cell(
 	 result,
 	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "hive_bin_cell",
-	 hive_bin_cell );
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 ) );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1095,13 +1976,11 @@ int regf_test_hive_bin_get_cell_at_offset(
      libregf_hive_bin_t *hive_bin )
 {
 	libcerror_error_t *error               = NULL;
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
 	int result                             = 0;
 
 	/* Test regular cases
 	 */
-	hive_bin_cell = NULL;
-
 	result = libregf_hive_bin_get_cell_at_offset(
 	          hive_bin,
 	          4096 + 32,
@@ -1113,19 +1992,38 @@ int regf_test_hive_bin_get_cell_at_offset(
 	 result,
 	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "hive_bin_cell",
-	 hive_bin_cell );
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 ) );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	hive_bin_cell = NULL;
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 144,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) ( 4096 + 32 + 144 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libregf_hive_bin_get_cell_at_offset(
 	          hive_bin,
-	          0,
+	          4096 + 32 + 8,
 	          &hive_bin_cell,
 	          &error );
 
@@ -1135,8 +2033,19 @@ int regf_test_hive_bin_get_cell_at_offset(
 	 0 );
 
 	REGF_TEST_ASSERT_IS_NULL(
-	 "hive_bin_cell",
-	 hive_bin_cell );
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          0,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1207,9 +2116,10 @@ int main(
 {
 #if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
 
-	libcerror_error_t *error     = NULL;
-	libregf_hive_bin_t *hive_bin = NULL;
-	int result                   = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libregf_hive_bin_t *hive_bin     = NULL;
+	int result                       = 0;
 
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
@@ -1230,10 +2140,26 @@ int main(
 	 "libregf_hive_bin_read_cells_data",
 	 regf_test_hive_bin_read_cells_data );
 
+	REGF_TEST_RUN(
+	 "libregf_hive_bin_set_data",
+	 regf_test_hive_bin_set_data );
+
+	REGF_TEST_RUN(
+	 "libregf_hive_bin_read_data_file_io_handle",
+	 regf_test_hive_bin_read_data_file_io_handle );
+
 	REGF_TEST_RUN(
 	 "libregf_hive_bin_read_cells_file_io_handle",
 	 regf_test_hive_bin_read_cells_file_io_handle );
 
+	REGF_TEST_RUN(
+	 "libregf_hive_bin_read_cell_at_offset",
+	 regf_test_hive_bin_read_cell_at_offset );
+
+	REGF_TEST_RUN(
+	 "libregf_hive_bin_get_cell_at_offset (cells table)",
+	 regf_test_hive_bin_get_cell_at_offset_cells_table );
+
 	/* Initialize test
 	 */
 	result = libregf_hive_bin_initialize(
@@ -1255,8 +2181,8 @@ int main(
 	 "error",
 	 error );
 
-	result = libregf_hive_bin_read_cells_data(
-	          hive_bin,
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
 	          &( regf_test_hive_bin_data1[ 32 ] ),
 	          4096 - 32,
 	          &error );
@@ -1266,6 +2192,38 @@ int main(
 	 result,
 	 1 );
 
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_read_cells_file_io_handle(
+	          hive_bin,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -1318,6 +2276,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	if( hive_bin != NULL )
 	{
 		libregf_hive_bin_free(
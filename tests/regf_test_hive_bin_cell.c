@@ -33,6 +33,7 @@
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_hive_bin.h"
 #include "../libregf/libregf_hive_bin_cell.h"
 
 #if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
@@ -270,6 +271,211 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_hive_bin_cell_reference_hive_bin and libregf_hive_bin_cell_free_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bin_cell_reference_hive_bin(
+     void )
+{
+	uint8_t cell_data[ 16 ] = {
+		0xf0, 0xff, 0xff, 0xff, 'n', 'k', 0x2c, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+	libregf_hive_bin_cell_t hive_bin_cell;
+
+	libcerror_error_t *error     = NULL;
+	libregf_hive_bin_t *hive_bin = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hive_bin_initialize(
+	          &hive_bin,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_set_data(
+	          hive_bin,
+	          cell_data,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	hive_bin_cell.offset   = 4096 + 32;
+	hive_bin_cell.data     = &( cell_data[ 4 ] );
+	hive_bin_cell.hive_bin = NULL;
+	hive_bin_cell.size     = 12;
+	hive_bin_cell.flags    = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bin_cell_reference_hive_bin(
+	          &hive_bin_cell,
+	          hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin_cell.hive_bin",
+	 hive_bin_cell.hive_bin );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin->number_of_references",
+	 hive_bin->number_of_references,
+	 2 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The hive bin should remain available when another reference is released
+	 */
+	result = libregf_hive_bin_free(
+	          &hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin_cell.hive_bin->number_of_references",
+	 hive_bin_cell.hive_bin->number_of_references,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "hive_bin_cell.data[ 0 ]",
+	 hive_bin_cell.data[ 0 ],
+	 (uint8_t) 'n' );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bin_cell_reference_hive_bin(
+	          &hive_bin_cell,
+	          hive_bin_cell.hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bin_cell_reference_hive_bin(
+	          NULL,
+	          hive_bin_cell.hive_bin,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bin_cell_free_data(
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin_cell.hive_bin",
+	 hive_bin_cell.hive_bin );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bin_cell_free_data(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libregf_hive_bin_cell_free_data(
+	 &hive_bin_cell,
+	 NULL );
+
+	if( hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &hive_bin,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +503,10 @@ int main(
 	 "libregf_hive_bin_cell_free",
 	 regf_test_hive_bin_cell_free );
 
+	REGF_TEST_RUN(
+	 "libregf_hive_bin_cell_reference_hive_bin",
+	 regf_test_hive_bin_cell_reference_hive_bin );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
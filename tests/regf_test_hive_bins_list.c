@@ -996,6 +996,166 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_hive_bins_list_resize_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_resize_cache(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	int number_of_cache_entries              = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_resize_cache(
+	          hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_number_of_entries(
+	          hive_bins_list->data_cache,
+	          &number_of_cache_entries,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_resize_cache(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_hive_bins_list_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -1084,6 +1244,15 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	 "error",
 	 error );
 
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list->page_hive_bin_indexes",
+	 hive_bins_list->page_hive_bin_indexes );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bins_list->number_of_pages",
+	 hive_bins_list->number_of_pages,
+	 (uint32_t) 1 );
+
 	/* Test error cases
 	 */
 	result = libregf_hive_bins_list_read_file_io_handle(
@@ -1489,6 +1658,21 @@ int regf_test_hive_bins_list_get_index_at_offset(
 	 "error",
 	 error );
 
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          4096,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libregf_hive_bins_list_get_index_at_offset(
@@ -1546,7 +1730,7 @@ int regf_test_hive_bins_list_get_cell_at_offset(
      libbfio_handle_t *file_io_handle )
 {
 	libcerror_error_t *error               = NULL;
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	libregf_hive_bin_cell_t hive_bin_cell;
 	int result                             = 0;
 
 	/* Test regular cases
@@ -1563,9 +1747,27 @@ int regf_test_hive_bins_list_get_cell_at_offset(
 	 result,
 	 1 );
 
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell.offset",
+	 hive_bin_cell.offset,
+	 (uint32_t) 32 );
+
 	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "hive_bin_cell",
-	 hive_bin_cell );
+	 "hive_bin_cell.data",
+	 hive_bin_cell.data );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bin_cell_free_data(
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1630,11 +1832,13 @@ on_error:
 int regf_test_hive_bins_list_read_element_data(
      void )
 {
-	libbfio_handle_t *file_io_handle      = NULL;
-	libcerror_error_t *error              = NULL;
-	libfcache_cache_t *cache              = NULL;
-	libfdata_list_element_t *list_element = NULL;
-	int result                            = 0;
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfcache_cache_t *cache                 = NULL;
+	libfdata_list_element_t *list_element    = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	int result                               = 0;
 
 	/* Initialize test
 	 */
@@ -1675,6 +1879,41 @@ int regf_test_hive_bins_list_read_element_data(
 	 "error",
 	 error );
 
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Initialize file IO handle
 	 */
 	result = regf_test_open_file_io_handle(
@@ -1699,7 +1938,7 @@ int regf_test_hive_bins_list_read_element_data(
 	/* Test regular cases
 	 */
 	result = libregf_hive_bins_list_read_element_data(
-	          NULL,
+	          hive_bins_list,
 	          file_io_handle,
 	          list_element,
 	          (libfdata_cache_t *) cache,
@@ -1723,7 +1962,7 @@ int regf_test_hive_bins_list_read_element_data(
 	 */
 	result = libregf_hive_bins_list_read_element_data(
 	          NULL,
-	          NULL,
+	          file_io_handle,
 	          list_element,
 	          (libfdata_cache_t *) cache,
 	          0,
@@ -1746,7 +1985,31 @@ int regf_test_hive_bins_list_read_element_data(
 	 &error );
 
 	result = libregf_hive_bins_list_read_element_data(
+	          hive_bins_list,
 	          NULL,
+	          list_element,
+	          (libfdata_cache_t *) cache,
+	          0,
+	          4096,
+	          4096,
+	          0,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_read_element_data(
+	          hive_bins_list,
 	          file_io_handle,
 	          NULL,
 	          (libfdata_cache_t *) cache,
@@ -1770,7 +2033,7 @@ int regf_test_hive_bins_list_read_element_data(
 	 &error );
 
 	result = libregf_hive_bins_list_read_element_data(
-	          NULL,
+	          hive_bins_list,
 	          file_io_handle,
 	          list_element,
 	          NULL,
@@ -1800,7 +2063,7 @@ int regf_test_hive_bins_list_read_element_data(
 	regf_test_malloc_attempts_before_fail = 0;
 
 	result = libregf_hive_bins_list_read_element_data(
-	          NULL,
+	          hive_bins_list,
 	          file_io_handle,
 	          list_element,
 	          (libfdata_cache_t *) cache,
@@ -1848,6 +2111,40 @@ int regf_test_hive_bins_list_read_element_data(
 
 	/* Clean up
 	 */
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfcache_cache_free(
 	          &cache,
 	          &error );
@@ -1896,6 +2193,18 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	if( cache != NULL )
 	{
 		libfcache_cache_free(
@@ -1954,6 +2263,10 @@ int main(
 	 "libregf_hive_bins_list_empty_cache",
 	 regf_test_hive_bins_list_empty_cache );
 
+	REGF_TEST_RUN(
+	 "libregf_hive_bins_list_resize_cache",
+	 regf_test_hive_bins_list_resize_cache );
+
 	REGF_TEST_RUN(
 	 "libregf_hive_bins_list_read_file_io_handle",
 	 regf_test_hive_bins_list_read_file_io_handle );
@@ -33,6 +33,7 @@
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_definitions.h"
 #include "../libregf/libregf_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
@@ -398,6 +399,195 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_io_handle_increment_counter function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_io_handle_increment_counter(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libregf_io_handle_t *io_handle = NULL;
+	uint64_t value                 = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_io_handle_increment_counter(
+	          io_handle,
+	          LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_increment_counter(
+	          io_handle,
+	          LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_get_statistic(
+	          io_handle,
+	          LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 4128 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_reset_statistics(
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_get_statistic(
+	          io_handle,
+	          LIBREGF_STATISTIC_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_io_handle_increment_counter(
+	          NULL,
+	          LIBREGF_IO_HANDLE_COUNTER_NUMBER_OF_BYTES_READ,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_io_handle_increment_counter(
+	          io_handle,
+	          -1,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +619,10 @@ int main(
 	 "libregf_io_handle_clear",
 	 regf_test_io_handle_clear );
 
+	REGF_TEST_RUN(
+	 "libregf_io_handle_increment_counter",
+	 regf_test_io_handle_increment_counter );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
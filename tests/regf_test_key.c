@@ -81,6 +81,7 @@ int regf_test_key_initialize(
 	          NULL,
 	          0,
 	          NULL,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -121,6 +122,7 @@ int regf_test_key_initialize(
 	          NULL,
 	          0,
 	          NULL,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -143,6 +145,7 @@ int regf_test_key_initialize(
 	          NULL,
 	          0,
 	          NULL,
+	          NULL,
 	          &error );
 
 	key = NULL;
@@ -165,6 +168,7 @@ int regf_test_key_initialize(
 	          NULL,
 	          0,
 	          NULL,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -195,6 +199,7 @@ int regf_test_key_initialize(
 		          NULL,
 		          0,
 		          NULL,
+		          NULL,
 		          &error );
 
 		if( regf_test_malloc_attempts_before_fail != -1 )
@@ -241,6 +246,7 @@ int regf_test_key_initialize(
 		          NULL,
 		          0,
 		          NULL,
+		          NULL,
 		          &error );
 
 		if( regf_test_memset_attempts_before_fail != -1 )
@@ -33,6 +33,7 @@
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_definitions.h"
 #include "../libregf/libregf_key_descriptor.h"
 
 #if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
@@ -270,6 +271,519 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_key_descriptor_get_hash_values_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_descriptor_get_hash_values_from_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 9 ]           = { 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+	uint8_t utf8_string_non_ascii[ 5 ] = { 'S', 0xc3, 0xa4, 'm', 0 };
+	libcerror_error_t *error           = NULL;
+	uint32_t name_hash                 = 0;
+	uint32_t name_hint                 = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_descriptor_get_hash_values_from_utf8_string(
+	          utf8_string,
+	          8,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0xe9fe1463UL );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hint",
+	 name_hint,
+	 (uint32_t) 0x54464f53UL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name with a non-ASCII character
+	 */
+	result = libregf_key_descriptor_get_hash_values_from_utf8_string(
+	          utf8_string_non_ascii,
+	          4,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hint",
+	 name_hint,
+	 (uint32_t) 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_descriptor_get_hash_values_from_utf8_string(
+	          NULL,
+	          8,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_descriptor_get_hash_values_from_utf8_string(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_descriptor_get_hash_values_from_utf8_string(
+	          utf8_string,
+	          8,
+	          NULL,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_descriptor_get_hash_values_from_utf8_string(
+	          utf8_string,
+	          8,
+	          &name_hash,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_descriptor_get_hash_values_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_descriptor_get_hash_values_from_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 9 ]           = { 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+	uint16_t utf16_string_non_ascii[ 4 ] = { 'S', 0x00e4, 'm', 0 };
+	libcerror_error_t *error             = NULL;
+	uint32_t name_hash                   = 0;
+	uint32_t name_hint                   = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_descriptor_get_hash_values_from_utf16_string(
+	          utf16_string,
+	          8,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0xe9fe1463UL );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hint",
+	 name_hint,
+	 (uint32_t) 0x54464f53UL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name with a non-ASCII character
+	 */
+	result = libregf_key_descriptor_get_hash_values_from_utf16_string(
+	          utf16_string_non_ascii,
+	          3,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hint",
+	 name_hint,
+	 (uint32_t) 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_descriptor_get_hash_values_from_utf16_string(
+	          NULL,
+	          8,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_descriptor_get_hash_values_from_utf16_string(
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_descriptor_get_hash_values_from_utf16_string(
+	          utf16_string,
+	          8,
+	          NULL,
+	          &name_hint,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_descriptor_get_hash_values_from_utf16_string(
+	          utf16_string,
+	          8,
+	          &name_hash,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_descriptor_compare_hash_value function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_descriptor_compare_hash_value(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_key_descriptor_t *key_descriptor = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_key_descriptor_initialize(
+	          &key_descriptor,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_descriptor",
+	 key_descriptor );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	key_descriptor->hash_type  = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH;
+	key_descriptor->hash_value = 0xe9fe1463UL;
+
+	result = libregf_key_descriptor_compare_hash_value(
+	          key_descriptor,
+	          0xe9fe1463UL,
+	          0x54464f53UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_descriptor->hash_type  = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH;
+	key_descriptor->hash_value = 0xe9fe1463UL;
+
+	result = libregf_key_descriptor_compare_hash_value(
+	          key_descriptor,
+	          0x0001c58dUL,
+	          0x004d4153UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_descriptor->hash_type  = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HASH;
+	key_descriptor->hash_value = 0xe9fe1463UL;
+
+	result = libregf_key_descriptor_compare_hash_value(
+	          key_descriptor,
+	          0,
+	          0x004d4153UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The name hint is compared case insensitive
+	 */
+	key_descriptor->hash_type  = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HINT;
+	key_descriptor->hash_value = 0x74666f53UL;
+
+	result = libregf_key_descriptor_compare_hash_value(
+	          key_descriptor,
+	          0xe9fe1463UL,
+	          0x54464f53UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_descriptor->hash_type  = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NAME_HINT;
+	key_descriptor->hash_value = 0x74666f53UL;
+
+	result = libregf_key_descriptor_compare_hash_value(
+	          key_descriptor,
+	          0xe9fe1463UL,
+	          0x004d4153UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_descriptor->hash_type  = LIBREGF_KEY_DESCRIPTOR_HASH_TYPE_NONE;
+	key_descriptor->hash_value = 0;
+
+	result = libregf_key_descriptor_compare_hash_value(
+	          key_descriptor,
+	          0xe9fe1463UL,
+	          0x004d4153UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_descriptor_compare_hash_value(
+	          NULL,
+	          0xe9fe1463UL,
+	          0x54464f53UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_key_descriptor_free(
+	          &key_descriptor,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_descriptor",
+	 key_descriptor );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_descriptor != NULL )
+	{
+		libregf_key_descriptor_free(
+		 &key_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +811,18 @@ int main(
 	 "libregf_key_descriptor_free",
 	 regf_test_key_descriptor_free );
 
+	REGF_TEST_RUN(
+	 "libregf_key_descriptor_get_hash_values_from_utf8_string",
+	 regf_test_key_descriptor_get_hash_values_from_utf8_string );
+
+	REGF_TEST_RUN(
+	 "libregf_key_descriptor_get_hash_values_from_utf16_string",
+	 regf_test_key_descriptor_get_hash_values_from_utf16_string );
+
+	REGF_TEST_RUN(
+	 "libregf_key_descriptor_compare_hash_value",
+	 regf_test_key_descriptor_compare_hash_value );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -35,6 +35,7 @@
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_definitions.h"
 #include "../libregf/libregf_hive_bins_list.h"
 #include "../libregf/libregf_io_handle.h"
 #include "../libregf/libregf_key_item.h"
@@ -789,6 +790,150 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_key_item_grab_reference and libregf_key_item_release_reference functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_reference(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libregf_key_item_t *key_item           = NULL;
+	libregf_key_item_t *key_item_reference = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_key_item_initialize(
+	          &key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_item",
+	 key_item );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_key_item_grab_reference(
+	          key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_item->number_of_references",
+	 key_item->number_of_references,
+	 2 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_item_reference = key_item;
+
+	result = libregf_key_item_release_reference(
+	          &key_item_reference,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item_reference",
+	 key_item_reference );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_item->number_of_references",
+	 key_item->number_of_references,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Releasing the last reference frees the key item
+	 */
+	result = libregf_key_item_release_reference(
+	          &key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item",
+	 key_item );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_grab_reference(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_release_reference(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_item != NULL )
+	{
+		libregf_key_item_free(
+		 &key_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_key_item_read function
  * Returns 1 if successful or 0 if not
  */
@@ -1748,7 +1893,7 @@ int regf_test_key_item_read_security_key(
 	libcerror_error_free(
 	 &error );
 
-	key_item->security_descriptor = (uint8_t *) 0x12345678UL;
+	key_item->security_key = (libregf_security_key_t *) 0x12345678UL;
 
 	result = libregf_key_item_read_security_key(
 	          key_item,
@@ -1757,7 +1902,7 @@ int regf_test_key_item_read_security_key(
 	          120,
 	          &error );
 
-	key_item->security_descriptor = NULL;
+	key_item->security_key = NULL;
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1931,6 +2076,144 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_key_item_read_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_read_on_demand(
+     libregf_key_item_t *key_item )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_read_on_demand(
+	          NULL,
+	          LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libregf_key_item_read_on_demand with a key item without a named key
+	 */
+	result = libregf_key_item_read_on_demand(
+	          key_item,
+	          LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libregf_key_item_read_on_demand does not read parts that were already read
+	 */
+	key_item->read_flags = LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME;
+
+	result = libregf_key_item_read_on_demand(
+	          key_item,
+	          LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	          &error );
+
+	key_item->read_flags = 0;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_read_value_name_hash_index function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_read_value_name_hash_index(
+     libregf_key_item_t *key_item )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_read_value_name_hash_index(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libregf_key_item_read_value_name_hash_index with a key item without a hive bins list
+	 */
+	result = libregf_key_item_read_value_name_hash_index(
+	          key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item->value_name_hash_index",
+	 key_item->value_name_hash_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_key_item_get_number_of_values function
  * Returns 1 if successful or 0 if not
  */
@@ -2041,6 +2324,10 @@ int main(
 	 "libregf_key_item_free",
 	 regf_test_key_item_free );
 
+	REGF_TEST_RUN(
+	 "libregf_key_item_reference",
+	 regf_test_key_item_reference );
+
 	REGF_TEST_RUN(
 	 "libregf_key_item_read",
 	 regf_test_key_item_read );
@@ -2090,6 +2377,16 @@ int main(
 
 	/* Run tests
 	 */
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_key_item_read_on_demand",
+	 regf_test_key_item_read_on_demand,
+	 key_item );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_key_item_read_value_name_hash_index",
+	 regf_test_key_item_read_value_name_hash_index,
+	 key_item );
+
 	REGF_TEST_RUN_WITH_ARGS(
 	 "libregf_key_item_get_number_of_values",
 	 regf_test_key_item_get_number_of_values,
@@ -0,0 +1,613 @@
+/*
+ * Library key_item_cache type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_io_handle.h"
+#include "../libregf/libregf_key_item.h"
+#include "../libregf/libregf_key_item_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_key_item_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	libregf_key_item_cache_t *key_item_cache = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 3;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_key_item_cache_initialize(
+	          &key_item_cache,
+	          io_handle,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_item_cache",
+	 key_item_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_item_cache_free(
+	          &key_item_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item_cache",
+	 key_item_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_cache_initialize(
+	          NULL,
+	          io_handle,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_item_cache = (libregf_key_item_cache_t *) 0x12345678UL;
+
+	result = libregf_key_item_cache_initialize(
+	          &key_item_cache,
+	          io_handle,
+	          8,
+	          &error );
+
+	key_item_cache = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_cache_initialize(
+	          &key_item_cache,
+	          NULL,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_cache_initialize(
+	          &key_item_cache,
+	          io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_key_item_cache_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_key_item_cache_initialize(
+		          &key_item_cache,
+		          io_handle,
+		          8,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( key_item_cache != NULL )
+			{
+				libregf_key_item_cache_free(
+				 &key_item_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "key_item_cache",
+			 key_item_cache );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_key_item_cache_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_key_item_cache_initialize(
+		          &key_item_cache,
+		          io_handle,
+		          8,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( key_item_cache != NULL )
+			{
+				libregf_key_item_cache_free(
+				 &key_item_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "key_item_cache",
+			 key_item_cache );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_item_cache != NULL )
+	{
+		libregf_key_item_cache_free(
+		 &key_item_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_cache_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_cache_get_key_item function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_cache_get_key_item(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	libregf_key_item_t *key_item             = NULL;
+	libregf_key_item_cache_t *key_item_cache = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_item_cache_initialize(
+	          &key_item_cache,
+	          io_handle,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_item_cache",
+	 key_item_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_cache_get_key_item(
+	          NULL,
+	          NULL,
+	          NULL,
+	          0x00001020UL,
+	          0,
+	          &key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_cache_get_key_item(
+	          key_item_cache,
+	          NULL,
+	          NULL,
+	          0x00001020UL,
+	          0,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_item = (libregf_key_item_t *) 0x12345678UL;
+
+	result = libregf_key_item_cache_get_key_item(
+	          key_item_cache,
+	          NULL,
+	          NULL,
+	          0x00001020UL,
+	          0,
+	          &key_item,
+	          &error );
+
+	key_item = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libregf_key_item_cache_get_key_item with a key item that cannot be read
+	 */
+	result = libregf_key_item_cache_get_key_item(
+	          key_item_cache,
+	          NULL,
+	          NULL,
+	          0x00001020UL,
+	          0,
+	          &key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item",
+	 key_item );
+
+	/* Clean up
+	 */
+	result = libregf_key_item_cache_free(
+	          &key_item_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item_cache",
+	 key_item_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_item_cache != NULL )
+	{
+		libregf_key_item_cache_free(
+		 &key_item_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_key_item_cache_initialize",
+	 regf_test_key_item_cache_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_key_item_cache_free",
+	 regf_test_key_item_cache_free );
+
+	REGF_TEST_RUN(
+	 "libregf_key_item_cache_get_key_item",
+	 regf_test_key_item_cache_get_key_item );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
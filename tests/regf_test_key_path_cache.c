@@ -0,0 +1,1409 @@
+/*
+ * Library key_path_cache type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_file_header.h"
+#include "../libregf/libregf_key_path_cache.h"
+#include "../libregf/libregf_libuna.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_key_path_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_key_path_cache_t *key_path_cache = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 2;
+	int number_of_memset_fail_tests          = 2;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_path_cache",
+	 key_path_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_free(
+	          &key_path_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_path_cache",
+	 key_path_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_cache_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_path_cache = (libregf_key_path_cache_t *) 0x12345678UL;
+
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          8,
+	          &error );
+
+	key_path_cache = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_key_path_cache_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_key_path_cache_initialize(
+		          &key_path_cache,
+		          8,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( key_path_cache != NULL )
+			{
+				libregf_key_path_cache_free(
+				 &key_path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "key_path_cache",
+			 key_path_cache );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_key_path_cache_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_key_path_cache_initialize(
+		          &key_path_cache,
+		          8,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( key_path_cache != NULL )
+			{
+				libregf_key_path_cache_free(
+				 &key_path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "key_path_cache",
+			 key_path_cache );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_path_cache != NULL )
+	{
+		libregf_key_path_cache_free(
+		 &key_path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_path_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_cache_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_path_cache_get_key_offset and libregf_key_path_cache_set_key_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_cache_get_key_offset(
+     void )
+{
+	libuna_unicode_character_t path1[ 3 ]    = { 'A', '\\', 'B' };
+	libuna_unicode_character_t path2[ 3 ]    = { 'A', '\\', 'C' };
+	libcerror_error_t *error                 = NULL;
+	libregf_key_path_cache_t *key_path_cache = NULL;
+	uint32_t key_offset                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_path_cache",
+	 key_path_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_set_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          0x00001000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00001000UL );
+
+	/* Test that a different path with the same hash is not matched
+	 */
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path2,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the same path relative to a different key is not matched
+	 */
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000040,
+	          path1,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an entry with the same index is replaced
+	 */
+	result = libregf_key_path_cache_set_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path2,
+	          3,
+	          0x12345678,
+	          0x00002000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path2,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00002000UL );
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_cache_get_key_offset(
+	          NULL,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          NULL,
+	          3,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          0,
+	          0x12345678,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_set_key_offset(
+	          NULL,
+	          0x00000020,
+	          path1,
+	          3,
+	          0x12345678,
+	          0x00001000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_set_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          NULL,
+	          3,
+	          0x12345678,
+	          0x00001000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_set_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path1,
+	          0,
+	          0x12345678,
+	          0x00001000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_key_path_cache_free(
+	          &key_path_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_path_cache",
+	 key_path_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_path_cache != NULL )
+	{
+		libregf_key_path_cache_free(
+		 &key_path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_path_cache_write_index_data and libregf_key_path_cache_read_index_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_cache_index_data(
+     void )
+{
+	uint8_t index_data[ 128 ];
+
+	libuna_unicode_character_t path[ 3 ]     = { 'A', '\\', 'B' };
+	libuna_unicode_character_t path2[ 1 ]    = { 'C' };
+	libcerror_error_t *error                 = NULL;
+	libregf_file_header_t *file_header       = NULL;
+	libregf_key_path_cache_t *key_path_cache = NULL;
+	size_t index_data_size                   = 0;
+	uint32_t key_offset                      = 0;
+	uint32_t path_hash                       = 0;
+	uint32_t path_hash2                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_header->primary_sequence_number   = 5;
+	file_header->secondary_sequence_number = 5;
+	file_header->hive_bins_size            = 8192;
+	file_header->checksum                  = 0x12345678UL;
+
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The path hash is calculated in the same way as by the key tree path lookup
+	 */
+	path_hash = 0x00000020UL;
+	path_hash = ( path_hash * 37 ) + 'A';
+	path_hash = ( path_hash * 37 ) + '\\';
+	path_hash = ( path_hash * 37 ) + 'B';
+
+	path_hash2 = ( 0x00000020UL * 37 ) + 'C';
+
+	result = libregf_key_path_cache_set_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path,
+	          3,
+	          path_hash,
+	          0x00001000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_set_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path2,
+	          1,
+	          path_hash2,
+	          0x00001800,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_key_path_cache_get_index_data_size(
+	          key_path_cache,
+	          &index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "index_data_size",
+	 index_data_size,
+	 (size_t) 68 );
+
+	result = libregf_key_path_cache_write_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_free(
+	          &key_path_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path,
+	          3,
+	          path_hash,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00001000UL );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path2,
+	          1,
+	          path_hash2,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00001800UL );
+
+	/* Test that an index of another state of the file is ignored
+	 */
+	file_header->secondary_sequence_number = 6;
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_header->secondary_sequence_number = 5;
+
+	/* Test that an index of another file is ignored
+	 */
+	file_header->checksum = 0x87654321UL;
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_header->checksum = 0x12345678UL;
+
+	file_header->hive_bins_size = 16384;
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_header->hive_bins_size = 8192;
+
+	/* Test that no entries of a truncated index are added to the cache
+	 */
+	result = libregf_key_path_cache_free(
+	          &key_path_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_initialize(
+	          &key_path_cache,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size - 4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path,
+	          3,
+	          path_hash,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_cache_get_key_offset(
+	          key_path_cache,
+	          0x00000020,
+	          path2,
+	          1,
+	          path_hash2,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with a key offset that exceeds the hive bins
+	 */
+	file_header->hive_bins_size = 4096;
+
+	index_data[ 16 ] = 0x00;
+	index_data[ 17 ] = 0x10;
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_header->hive_bins_size = 8192;
+
+	index_data[ 16 ] = 0x00;
+	index_data[ 17 ] = 0x20;
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_cache_get_index_data_size(
+	          NULL,
+	          &index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_get_index_data_size(
+	          key_path_cache,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_write_index_data(
+	          NULL,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_write_index_data(
+	          key_path_cache,
+	          NULL,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_write_index_data(
+	          key_path_cache,
+	          file_header,
+	          NULL,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_write_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_read_index_data(
+	          NULL,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          NULL,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          NULL,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with a path length that exceeds the data
+	 */
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size - 4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with an invalid signature
+	 */
+	index_data[ 0 ] = 0xff;
+
+	result = libregf_key_path_cache_read_index_data(
+	          key_path_cache,
+	          file_header,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_key_path_cache_free(
+	          &key_path_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_file_header_free(
+	          &file_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_path_cache != NULL )
+	{
+		libregf_key_path_cache_free(
+		 &key_path_cache,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libregf_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_cache_initialize",
+	 regf_test_key_path_cache_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_cache_free",
+	 regf_test_key_path_cache_free );
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_cache_get_key_offset",
+	 regf_test_key_path_cache_get_key_offset );
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_cache_index_data",
+	 regf_test_key_path_cache_index_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,548 @@
+/*
+ * Library key_tree functions test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_hive_bin_cell.h"
+#include "../libregf/libregf_key_tree.h"
+
+uint8_t regf_test_key_tree_named_key_data1[ 140 ] = {
+	0x6e, 0x6b, 0x2c, 0x00, 0x0d, 0x3f, 0x8a, 0x46, 0x68, 0x22, 0xd2, 0x01, 0x02, 0x00, 0x00, 0x00,
+	0x68, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x14, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x2c, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x33, 0x00, 0x39, 0x00, 0x00, 0x00, 0x43, 0x73, 0x69, 0x54,
+	0x6f, 0x6f, 0x6c, 0x2d, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x48, 0x69, 0x76, 0x65, 0x2d, 0x7b,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x30, 0x30,
+	0x30, 0x30, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x7d, 0x00, 0x39, 0x00, 0x31, 0x00, 0x45, 0x00 };
+
+uint8_t regf_test_key_tree_value_key_data1[ 36 ] = {
+	0x76, 0x6b, 0x0c, 0x00, 0x22, 0x00, 0x00, 0x00, 0x30, 0xdc, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x44, 0x69, 0x73, 0x70, 0x46, 0x69, 0x6c, 0x65, 0x4e, 0x61, 0x6d, 0x65,
+	0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_key_tree_walk_read_named_key function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_tree_walk_read_named_key(
+     void )
+{
+	uint8_t named_key_data[ 140 ];
+
+	libregf_hive_bin_cell_t hive_bin_cell;
+	libregf_walk_key_t walk_key;
+
+	libcerror_error_t *error      = NULL;
+	uint32_t sub_keys_list_offset = 0;
+	uint32_t values_list_offset   = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	hive_bin_cell.offset    = 0x00001020UL;
+	hive_bin_cell.data      = regf_test_key_tree_named_key_data1;
+	hive_bin_cell.hive_bin  = NULL;
+	hive_bin_cell.size      = 140;
+	hive_bin_cell.flags     = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_key,
+	          &values_list_offset,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "walk_key.name_size",
+	 walk_key.name_size,
+	 (size_t) 57 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "walk_key.name_is_ascii",
+	 walk_key.name_is_ascii,
+	 (uint8_t) 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_key.number_of_sub_keys",
+	 walk_key.number_of_sub_keys,
+	 (uint32_t) 10 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_key.number_of_values",
+	 walk_key.number_of_values,
+	 (uint32_t) 0 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_keys_list_offset",
+	 sub_keys_list_offset,
+	 (uint32_t) 0x000014d8UL );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "values_list_offset",
+	 values_list_offset,
+	 (uint32_t) 0xffffffffUL );
+
+	result = memory_compare(
+	          walk_key.name,
+	          "CsiTool-CreateHive-{00000000-0000-0000-0000-000000000000}",
+	          57 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libregf_key_tree_walk_read_named_key(
+	          NULL,
+	          0,
+	          &walk_key,
+	          &values_list_offset,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          NULL,
+	          &values_list_offset,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_key,
+	          NULL,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_key,
+	          &values_list_offset,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a cell that is too small to contain a named key
+	 */
+	hive_bin_cell.size = 8;
+
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_key,
+	          &values_list_offset,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a name size that exceeds the cell
+	 */
+	hive_bin_cell.size = 100;
+
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_key,
+	          &values_list_offset,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	if( memory_copy(
+	     named_key_data,
+	     regf_test_key_tree_named_key_data1,
+	     140 ) == NULL )
+	{
+		goto on_error;
+	}
+	named_key_data[ 0 ] = (uint8_t) 'v';
+
+	hive_bin_cell.data = named_key_data;
+	hive_bin_cell.size = 140;
+
+	result = libregf_key_tree_walk_read_named_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_key,
+	          &values_list_offset,
+	          &sub_keys_list_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_tree_walk_read_value_key function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_tree_walk_read_value_key(
+     void )
+{
+	uint8_t value_key_data[ 36 ];
+
+	libregf_hive_bin_cell_t hive_bin_cell;
+	libregf_walk_value_t walk_value;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	hive_bin_cell.offset    = 0x00001020UL;
+	hive_bin_cell.data      = regf_test_key_tree_value_key_data1;
+	hive_bin_cell.hive_bin  = NULL;
+	hive_bin_cell.size      = 36;
+	hive_bin_cell.flags     = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_tree_walk_read_value_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "walk_value.name_size",
+	 walk_value.name_size,
+	 (size_t) 12 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "walk_value.name_is_ascii",
+	 walk_value.name_is_ascii,
+	 (uint8_t) 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_value.value_type",
+	 walk_value.value_type,
+	 (uint32_t) 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_value.data_size",
+	 walk_value.data_size,
+	 (uint32_t) 0x22 );
+
+	result = memory_compare(
+	          walk_value.name,
+	          "DispFileName",
+	          12 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libregf_key_tree_walk_read_value_key(
+	          NULL,
+	          0,
+	          &walk_value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_tree_walk_read_value_key(
+	          &hive_bin_cell,
+	          0,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a cell that is too small to contain a value key
+	 */
+	hive_bin_cell.size = 8;
+
+	result = libregf_key_tree_walk_read_value_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a name size that exceeds the cell
+	 */
+	hive_bin_cell.size = 24;
+
+	result = libregf_key_tree_walk_read_value_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	if( memory_copy(
+	     value_key_data,
+	     regf_test_key_tree_value_key_data1,
+	     36 ) == NULL )
+	{
+		goto on_error;
+	}
+	value_key_data[ 0 ] = (uint8_t) 'n';
+
+	hive_bin_cell.data = value_key_data;
+	hive_bin_cell.size = 36;
+
+	result = libregf_key_tree_walk_read_value_key(
+	          &hive_bin_cell,
+	          0,
+	          &walk_value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_key_tree_walk_read_named_key",
+	 regf_test_key_tree_walk_read_named_key );
+
+	REGF_TEST_RUN(
+	 "libregf_key_tree_walk_read_value_key",
+	 regf_test_key_tree_walk_read_value_key );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
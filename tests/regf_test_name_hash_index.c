@@ -0,0 +1,616 @@
+/*
+ * Library name_hash_index type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_name_hash_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_name_hash_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_name_hash_index_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libregf_name_hash_index_t *name_hash_index = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 4;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_name_hash_index_initialize(
+	          &name_hash_index,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_index",
+	 name_hash_index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_name_hash_index_free(
+	          &name_hash_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "name_hash_index",
+	 name_hash_index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_name_hash_index_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_hash_index = (libregf_name_hash_index_t *) 0x12345678UL;
+
+	result = libregf_name_hash_index_initialize(
+	          &name_hash_index,
+	          8,
+	          &error );
+
+	name_hash_index = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_name_hash_index_initialize(
+	          &name_hash_index,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "name_hash_index",
+	 name_hash_index );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_name_hash_index_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_name_hash_index_initialize(
+		          &name_hash_index,
+		          8,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( name_hash_index != NULL )
+			{
+				libregf_name_hash_index_free(
+				 &name_hash_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "name_hash_index",
+			 name_hash_index );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_name_hash_index_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_name_hash_index_initialize(
+		          &name_hash_index,
+		          8,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( name_hash_index != NULL )
+			{
+				libregf_name_hash_index_free(
+				 &name_hash_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "name_hash_index",
+			 name_hash_index );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_index != NULL )
+	{
+		libregf_name_hash_index_free(
+		 &name_hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_name_hash_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_name_hash_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_name_hash_index_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_name_hash_index_set_entry, libregf_name_hash_index_get_first_entry_index
+ * and libregf_name_hash_index_get_next_entry_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_name_hash_index_get_entry_index(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libregf_name_hash_index_t *name_hash_index = NULL;
+	int entry_index                            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_name_hash_index_initialize(
+	          &name_hash_index,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_index",
+	 name_hash_index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Entries 1 and 3 share the same name hash, entries 0 and 2 share the same bucket
+	 */
+	for( entry_index = 3;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		result = libregf_name_hash_index_set_entry(
+		          name_hash_index,
+		          entry_index,
+		          ( ( entry_index % 2 ) == 1 ) ? 0x00001235UL : 0x00001234UL + (uint32_t) ( entry_index * 4 ),
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libregf_name_hash_index_get_first_entry_index(
+	          name_hash_index,
+	          0x00001235UL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_name_hash_index_get_next_entry_index(
+	          name_hash_index,
+	          0x00001235UL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 3 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_name_hash_index_get_next_entry_index(
+	          name_hash_index,
+	          0x00001235UL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_name_hash_index_get_first_entry_index(
+	          name_hash_index,
+	          0x0000123cUL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_name_hash_index_get_first_entry_index(
+	          name_hash_index,
+	          0x00005678UL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_name_hash_index_set_entry(
+	          name_hash_index,
+	          1,
+	          0x00001235UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_name_hash_index_set_entry(
+	          name_hash_index,
+	          4,
+	          0x00001235UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_name_hash_index_get_first_entry_index(
+	          NULL,
+	          0x00001235UL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_name_hash_index_get_first_entry_index(
+	          name_hash_index,
+	          0x00001235UL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entry_index = -1;
+
+	result = libregf_name_hash_index_get_next_entry_index(
+	          name_hash_index,
+	          0x00001235UL,
+	          &entry_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_name_hash_index_free(
+	          &name_hash_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "name_hash_index",
+	 name_hash_index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_index != NULL )
+	{
+		libregf_name_hash_index_free(
+		 &name_hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_name_hash_index_initialize",
+	 regf_test_name_hash_index_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_name_hash_index_free",
+	 regf_test_name_hash_index_free );
+
+	REGF_TEST_RUN(
+	 "libregf_name_hash_index_get_entry_index",
+	 regf_test_name_hash_index_get_entry_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
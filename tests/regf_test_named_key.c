@@ -31,6 +31,7 @@
 
 #include "regf_test_libcerror.h"
 #include "regf_test_libregf.h"
+#include "regf_test_libuna.h"
 #include "regf_test_macros.h"
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
@@ -1486,6 +1487,324 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_named_key_compare_sort_order_with_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_named_key_compare_sort_order_with_utf8_string(
+     libregf_named_key_t *named_key )
+{
+	uint8_t utf8_string1[ 58 ] = {
+	        'c', 's', 'i', 't', 'o', 'o', 'l', '-', 'c', 'r', 'e', 'a', 't', 'e', 'h', 'i',
+	        'v', 'e', '-', '{', '0', '0', '0', '0', '0', '0', '0', '0', '-', '0', '0', '0',
+	        '0', '-', '0', '0', '0', '0', '-', '0', '0', '0', '0', '-', '0', '0', '0', '0',
+	        '0', '0', '0', '0', '0', '0', '0', '0', '}', 0 };
+
+	uint8_t utf8_string2[ 6 ] = {
+		'B', 'o', 'g', 'u', 's', 0 };
+
+	uint8_t utf8_string3[ 9 ] = {
+		'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          named_key,
+	          utf8_string1,
+	          57,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          named_key,
+	          utf8_string2,
+	          5,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          named_key,
+	          utf8_string3,
+	          8,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that is a prefix of the name
+	 */
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          named_key,
+	          utf8_string1,
+	          7,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          NULL,
+	          utf8_string1,
+	          57,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          named_key,
+	          NULL,
+	          57,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_named_key_compare_sort_order_with_utf8_string(
+	          named_key,
+	          utf8_string1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_named_key_compare_sort_order_with_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_named_key_compare_sort_order_with_utf16_string(
+     libregf_named_key_t *named_key )
+{
+	uint16_t utf16_string1[ 58 ] = {
+	        'c', 's', 'i', 't', 'o', 'o', 'l', '-', 'c', 'r', 'e', 'a', 't', 'e', 'h', 'i',
+	        'v', 'e', '-', '{', '0', '0', '0', '0', '0', '0', '0', '0', '-', '0', '0', '0',
+	        '0', '-', '0', '0', '0', '0', '-', '0', '0', '0', '0', '-', '0', '0', '0', '0',
+	        '0', '0', '0', '0', '0', '0', '0', '0', '}', 0 };
+
+	uint16_t utf16_string2[ 6 ] = {
+		'B', 'o', 'g', 'u', 's', 0 };
+
+	uint16_t utf16_string3[ 9 ] = {
+		'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          named_key,
+	          utf16_string1,
+	          57,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          named_key,
+	          utf16_string2,
+	          5,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          named_key,
+	          utf16_string3,
+	          8,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that is a prefix of the name
+	 */
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          named_key,
+	          utf16_string1,
+	          7,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          NULL,
+	          utf16_string1,
+	          57,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          named_key,
+	          NULL,
+	          57,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_named_key_compare_sort_order_with_utf16_string(
+	          named_key,
+	          utf16_string1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBREGF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_named_key_get_last_written_time function
  * Returns 1 if successful or 0 if not
  */
@@ -1700,6 +2019,16 @@ int main(
 	 regf_test_named_key_compare_name_with_utf16_string,
 	 named_key );
 
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_named_key_compare_sort_order_with_utf8_string",
+	 regf_test_named_key_compare_sort_order_with_utf8_string,
+	 named_key );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_named_key_compare_sort_order_with_utf16_string",
+	 regf_test_named_key_compare_sort_order_with_utf16_string,
+	 named_key );
+
 	REGF_TEST_RUN_WITH_ARGS(
 	 "libregf_named_key_get_last_written_time",
 	 regf_test_named_key_get_last_written_time,
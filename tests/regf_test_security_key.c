@@ -35,6 +35,7 @@
 #include "regf_test_unused.h"
 
 #include "../libregf/libregf_io_handle.h"
+#include "../libregf/libregf_libcdata.h"
 #include "../libregf/libregf_security_key.h"
 
 uint8_t regf_test_security_key_data1[ 180 ] = {
@@ -286,6 +287,187 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_security_key_compare_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_security_key_compare_by_offset(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libregf_security_key_t *first_security_key  = NULL;
+	libregf_security_key_t *second_security_key = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_security_key_initialize(
+	          &first_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_security_key",
+	 first_security_key );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_security_key_initialize(
+	          &second_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "second_security_key",
+	 second_security_key );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_security_key->offset  = 0x00001020UL;
+	second_security_key->offset = 0x00002040UL;
+
+	/* Test regular cases
+	 */
+	result = libregf_security_key_compare_by_offset(
+	          first_security_key,
+	          second_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_security_key_compare_by_offset(
+	          second_security_key,
+	          first_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_security_key_compare_by_offset(
+	          first_security_key,
+	          first_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_security_key_compare_by_offset(
+	          NULL,
+	          second_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_security_key_compare_by_offset(
+	          first_security_key,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_security_key_free(
+	          &second_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_security_key_free(
+	          &first_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_security_key != NULL )
+	{
+		libregf_security_key_free(
+		 &second_security_key,
+		 NULL );
+	}
+	if( first_security_key != NULL )
+	{
+		libregf_security_key_free(
+		 &first_security_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_security_key_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -696,6 +878,10 @@ int main(
 	 "libregf_security_key_free",
 	 regf_test_security_key_free );
 
+	REGF_TEST_RUN(
+	 "libregf_security_key_compare_by_offset",
+	 regf_test_security_key_compare_by_offset );
+
 	REGF_TEST_RUN(
 	 "libregf_security_key_read_data",
 	 regf_test_security_key_read_data );
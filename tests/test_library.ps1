@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "checksum data_block_key data_block_stream data_type dirty_vector error file_header hive_bin hive_bin_cell hive_bin_header hive_bins_list io_handle key key_descriptor key_item multi_string named_key notify security_key sub_key_list value value_item value_key"
+$LibraryTests = "checksum data_block_key data_block_stream data_type dirty_vector error file_header hive_bin hive_bin_cell hive_bin_header hive_bins_list io_handle key key_descriptor key_item key_item_cache key_path_cache key_tree multi_string name_hash_index named_key notify security_key sub_key_list value value_item value_key"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 